@@ -1,6 +1,7 @@
 #include "CodeToolApp.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <fstream>
 #include <functional> 
@@ -8,6 +9,7 @@
 #include <locale>
 #include <sstream>
 #include <shlwapi.h>
+#include <thread>
 #include <windows.h>
 #include <iostream>
 
@@ -104,9 +106,9 @@ void CodeToolApplication::VerboseLog(const char* format, ...)
 	va_end(vlist);
 }
 
-map<string, TimeStamp> CodeToolApplication::GetFolderFiles(const string& path)
+set<string> CodeToolApplication::GetFolderFiles(const string& path)
 {
-	map<string, TimeStamp> res;
+	set<string> res;
 
 	WIN32_FIND_DATA f;
 	HANDLE h = FindFirstFile((path + "/*").c_str(), &f);
@@ -120,14 +122,9 @@ map<string, TimeStamp> CodeToolApplication::GetFolderFiles(const string& path)
 			if (f.dwFileAttributes == FILE_ATTRIBUTE_DIRECTORY)
 			{
 				auto subFolderFiles = GetFolderFiles(path + "/" + f.cFileName);
-				for (auto x : subFolderFiles)
-					res[x.first] = x.second;
-			}
-			else
-			{
-				string filePath = path + "/" + f.cFileName;
-				res[filePath] = GetFileEditedDate(filePath);
+				res.insert(subFolderFiles.begin(), subFolderFiles.end());
 			}
+			else res.insert(path + "/" + f.cFileName);
 		}
 		while (FindNextFile(h, &f));
 	}
@@ -137,34 +134,6 @@ map<string, TimeStamp> CodeToolApplication::GetFolderFiles(const string& path)
 	return res;
 }
 
-TimeStamp CodeToolApplication::GetFileEditedDate(const string& path)
-{
-	FILETIME creationTime, lastAccessTime, lastWriteTime;
-	HANDLE hFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
-							   FILE_FLAG_OVERLAPPED, NULL);
-
-	if (hFile == NULL || hFile == INVALID_HANDLE_VALUE)
-		return TimeStamp();
-
-	if (!GetFileTime(hFile, &creationTime, &lastAccessTime, &lastWriteTime))
-	{
-		CloseHandle(hFile);
-		return TimeStamp();
-	}
-
-	SYSTEMTIME stUTC, stLocal;
-
-	FileTimeToSystemTime(&lastWriteTime, &stUTC);
-	SystemTimeToTzSpecificLocalTime(NULL, &stUTC, &stLocal);
-
-	TimeStamp res(stLocal.wSecond, stLocal.wMinute, stLocal.wHour, stLocal.wDay, stLocal.wMonth,
-				  stLocal.wYear);
-
-	CloseHandle(hFile);
-
-	return res;
-}
-
 map<string, string> CodeToolApplication::ParseArguments(char** args, int nargs)
 {
 	map<string, string> res;
@@ -290,9 +259,9 @@ void CodeToolApplication::UpdateProjectFilesFilter()
 
 	vector<string> filters;
 	vector<string> files;
-	for (auto file : mSourceFiles)
+	for (auto& file : mSourceFiles)
 	{
-		string filePath = file.first;
+		string filePath = file;
 
 		if (!EndsWith(filePath, ".h") && !EndsWith(filePath, ".cpp"))
 			continue;
@@ -505,69 +474,129 @@ void CodeToolApplication::UpdateProjectFilesFilter()
 
 void CodeToolApplication::UpdateCodeReflection()
 {
-	mParser = new CppSyntaxParser();
-
 	// get all files in sources path
 	mSourceFiles = GetFolderFiles(mSourcesPath);
 
-	// parse all headers
-	for (auto fileInfo : mSourceFiles)
+	vector<string> headers;
+	for (auto& path : mSourceFiles)
 	{
-		if (!EndsWith(fileInfo.first, ".h"))
-			continue;
+		if (EndsWith(path, ".h"))
+			headers.push_back(path);
+	}
 
-		ParseSource(fileInfo.first, fileInfo.second);
+	// read headers and calculate content hashes
+	int headersCount = (int)headers.size();
+	vector<string> headersData(headersCount);
+	vector<unsigned long long> headersHashes(headersCount);
+
+	ProcessParallel(headersCount, [&](int idx, int worker)
+	{
+		headersData[idx] = ReadFile(headers[idx]);
+		headersHashes[idx] = SyntaxFile::CalculateDataHash(headersData[idx]);
+	});
+
+	// check hashes, changed and new headers will be parsed
+	vector<int> changedHeaders;
+	for (int i = 0; i < headersCount; i++)
+	{
+		if (!IsCachedSourceActual(headers[i], headersHashes[i]))
+			changedHeaders.push_back(i);
 	}
 
 	// remove old sources from cache
 	for (auto parseFileInfo = mCache.originalFiles.begin(); parseFileInfo != mCache.originalFiles.end();)
 	{
-		auto fnd = find_if(mSourceFiles.begin(), mSourceFiles.end(), [&](auto x) { return x.first == (*parseFileInfo)->GetPath(); });
-		if (fnd == mSourceFiles.end())
+		SyntaxFile* cacheFile = *parseFileInfo;
+		if (mSourceFiles.find(cacheFile->GetPath()) == mSourceFiles.end())
 		{
-			delete *parseFileInfo;
 			parseFileInfo = mCache.originalFiles.erase(parseFileInfo);
-			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), *parseFileInfo));
+			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), cacheFile));
+			delete cacheFile;
 		}
 		else ++parseFileInfo;
 	}
 
+	// parse changed headers, each worker has own parser
+	int changedCount = (int)changedHeaders.size();
+	vector<SyntaxFile*> parsedFiles(changedCount);
+	vector<CppSyntaxParser*> parsers;
+	for (int i = 0; i < GetWorkersCount(changedCount); i++)
+		parsers.push_back(new CppSyntaxParser());
+
+	ProcessParallel(changedCount, [&](int idx, int worker)
+	{
+		int headerIdx = changedHeaders[idx];
+
+		SyntaxFile* syntaxFile = new SyntaxFile();
+		parsers[worker]->ParseFile(*syntaxFile, headers[headerIdx], headersData[headerIdx]);
+		parsedFiles[idx] = syntaxFile;
+
+		VerboseLog("Parsed %s\n", headers[headerIdx].c_str());
+	});
+
+	for (auto parser : parsers)
+		delete parser;
+
+	// results are added in files order, so cache doesn't depend on threads timings
+	for (auto syntaxFile : parsedFiles)
+	{
+		mParsedFiles.push_back(syntaxFile);
+		mCache.originalFiles.push_back(syntaxFile);
+		mCache.files.push_back(syntaxFile);
+	}
+
 	mCache.UpdateGlobalNamespace();
 
 	// update reflection
 	for (auto file : mParsedFiles)
 		UpdateSourceReflection(file);
-
-	delete mParser;
 }
 
-void CodeToolApplication::ParseSource(const string& path, const TimeStamp& editDate)
+bool CodeToolApplication::IsCachedSourceActual(const string& path, unsigned long long dataHash)
 {
-	// check edit date
 	for (auto cacheFile : mCache.originalFiles)
 	{
 		if (path == cacheFile->GetPath())
 		{
-			if (editDate == cacheFile->GetLastEditedDate())
-				return;
+			if (dataHash == cacheFile->GetDataHash())
+				return true;
 
-			delete cacheFile;
 			mCache.originalFiles.erase(find(mCache.originalFiles.begin(), mCache.originalFiles.end(), cacheFile));
 			mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), cacheFile));
+			delete cacheFile;
 
-			break;
+			return false;
 		}
 	}
 
-	// parse source
-	SyntaxFile* syntaxFile = new SyntaxFile();
-	mParser->ParseFile(*syntaxFile, path, editDate);
-	mParsedFiles.push_back(syntaxFile);
+	return false;
+}
 
-	mCache.originalFiles.push_back(syntaxFile);
-	mCache.files.push_back(syntaxFile);
+int CodeToolApplication::GetWorkersCount(int count) const
+{
+	int hardwareThreads = max(1, (int)thread::hardware_concurrency());
+	return max(1, min(count, hardwareThreads));
+}
+
+void CodeToolApplication::ProcessParallel(int count, const function<void(int, int)>& func) const
+{
+	int workersCount = GetWorkersCount(count);
+	atomic<int> nextItem(0);
 
-	VerboseLog("Parsed %s\n", path.c_str());
+	auto worker = [&](int workerIdx)
+	{
+		for (int idx = nextItem++; idx < count; idx = nextItem++)
+			func(idx, workerIdx);
+	};
+
+	vector<thread> threads;
+	for (int i = 1; i < workersCount; i++)
+		threads.emplace_back(worker, i);
+
+	worker(0);
+
+	for (auto& t : threads)
+		t.join();
 }
 
 void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
@@ -668,7 +697,10 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
 	if (hSource != file->GetData())
 	{
 		WriteFile(file->GetPath(), hSource);
-		file->mLastEditedDate = GetFileEditedDate(file->GetPath());
+
+		// Cache must keep hash of written data, otherwise header will be parsed again at next run
+		file->mData = hSource;
+		file->mDataHash = SyntaxFile::CalculateDataHash(hSource);
 	}
 
 	VerboseLog("Reflection generated for %s\n", file->GetPath().c_str());
@@ -728,6 +760,21 @@ string CodeToolApplication::GetClassMeta(SyntaxClass* cls)
 		
 		res += string("\tBASE_CLASS(") + className +  +");\n";
 	}
+
+	// class attributes from comment above class
+	SyntaxComment* classComment = cls->GetParentSection() ? cls->GetParentSection()->FindCommentNearLine(cls->GetLine()) : nullptr;
+	if (classComment)
+	{
+		for (auto attributeClass : mCache.attributes)
+		{
+			if (!attributeClass->GetAttributeCommentDef().empty() &&
+				classComment->GetData().find("@" + attributeClass->GetAttributeCommentDef()) != string::npos)
+			{
+				res += string("\tCLASS_ATTRIBUTE(") + attributeClass->GetFullName() + ");\n";
+			}
+		}
+	}
+
 	res += "}\nEND_META;\n";
 
 	// fields
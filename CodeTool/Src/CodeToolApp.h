@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+#include <set>
 #include <windows.h>
 #include "CppSyntaxParser.h"
 
@@ -95,17 +97,13 @@ protected:
 	bool                   mNeedReset = true;
 	static bool            mVerbose;
 					       
-	CppSyntaxParser*       mParser;
 	vector<SyntaxFile*>    mParsedFiles;
 	CodeToolCache          mCache;
-	map<string, TimeStamp> mSourceFiles;
+	set<string>            mSourceFiles;
 
 protected:
 	// Returns list of all files in path and in sub paths
-	map<string, TimeStamp> GetFolderFiles(const string& path);
-
-	// Returns last edited date for file
-	TimeStamp GetFileEditedDate(const string& path);
+	set<string> GetFolderFiles(const string& path);
 
 	// Parses startup arguments and puts into map
 	map<string, string> ParseArguments(char** args, int nargs);
@@ -140,8 +138,14 @@ protected:
 	// Updates code reflection
 	void UpdateCodeReflection();
 
-	// Parses source file
-	void ParseSource(const string& path, const TimeStamp& editDate);
+	// Returns true when cached source has same content hash; removes changed source from cache
+	bool IsCachedSourceActual(const string& path, unsigned long long dataHash);
+
+	// Returns count of worker threads for processing count items
+	int GetWorkersCount(int count) const;
+
+	// Calls func(item, worker) for items from 0 to count on worker threads
+	void ProcessParallel(int count, const function<void(int, int)>& func) const;
 
 	// Updates reflection for classes in source
 	void UpdateSourceReflection(SyntaxFile* file);
@@ -138,19 +138,11 @@ void CppSyntaxParser::InitializeParsers()
 	mParsers.push_back(new ExpressionParser("ACCESSOR", &CppSyntaxParser::ParseAccessor, true, false));
 }
 
-void CppSyntaxParser::ParseFile(SyntaxFile& file, const string& filePath, const TimeStamp& fileEditDate)
+void CppSyntaxParser::ParseFile(SyntaxFile& file, const string& filePath, const string& fileData)
 {
 	file.mPath = filePath;
-	file.mLastEditedDate = fileEditDate;
-
-	ifstream fin;
-	fin.open(filePath.c_str());
-	if (!fin.is_open())
-		return;
-
-	file.mData = string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
-
-	fin.close();
+	file.mData = fileData;
+	file.mDataHash = SyntaxFile::CalculateDataHash(fileData);
 
 	if (file.mData.find("@CODETOOLIGNORE") != string::npos)
 		return;
@@ -16,7 +16,7 @@ public:
 	CppSyntaxParser();
 	~CppSyntaxParser();
 
-	void ParseFile(SyntaxFile& file, const string& filePath, const TimeStamp& fileEditDate);
+	void ParseFile(SyntaxFile& file, const string& filePath, const string& fileData);
 
 protected:
 	typedef void(CppSyntaxParser::*ParserDelegate)(SyntaxSection&, int&, SyntaxProtectionSection&);
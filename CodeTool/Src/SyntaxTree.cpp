@@ -1,6 +1,8 @@
 #include "SyntaxTree.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 
 SyntaxFile::SyntaxFile():
 	mGlobalNamespace(new SyntaxNamespace())
@@ -21,9 +23,9 @@ const string& SyntaxFile::GetData() const
 	return mData;
 }
 
-const TimeStamp& SyntaxFile::GetLastEditedDate() const
+unsigned long long SyntaxFile::GetDataHash() const
 {
-	return mLastEditedDate;
+	return mDataHash;
 }
 
 SyntaxNamespace* SyntaxFile::GetGlobalNamespace() const
@@ -33,21 +35,36 @@ SyntaxNamespace* SyntaxFile::GetGlobalNamespace() const
 
 void SyntaxFile::SaveTo(pugi::xml_node& node) const
 {
+	char hash[32];
+	sprintf_s(hash, "%016llx", mDataHash);
+
 	node.append_attribute("path") = mPath.c_str();
-	mLastEditedDate.SaveTo(node.append_child("date"));
+	node.append_attribute("hash") = hash;
 	mGlobalNamespace->SaveTo(node.append_child("globalNamespace"));
 }
 
 void SyntaxFile::LoadFrom(pugi::xml_node& node)
 {
 	mPath = node.attribute("path").as_string();
-	mLastEditedDate.LoadFrom(node.child("date"));
+	mDataHash = strtoull(node.attribute("hash").as_string(), nullptr, 16);
 
 	delete mGlobalNamespace;
 	mGlobalNamespace = new SyntaxNamespace();
 	mGlobalNamespace->LoadFrom(node.child("globalNamespace"));
 }
 
+unsigned long long SyntaxFile::CalculateDataHash(const string& data)
+{
+	unsigned long long hash = 14695981039346656037ull;
+	for (auto c : data)
+	{
+		hash ^= (unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
 int ISyntaxExpression::GetBegin() const
 {
 	return mBegin;
@@ -671,42 +688,6 @@ void SyntaxTypedef::LoadFrom(pugi::xml_node& node)
 	mNewDefName = node.attribute("newDef").as_string();
 }
 
-TimeStamp::TimeStamp(int seconds /*= 0*/, int minutes /*= 0*/, int hours /*= 0*/, int days /*= 0*/, int months /*= 0*/,
-					 int years /*= 0*/):
-	second(seconds), minute(minutes), hour(hours), day(days), month(months), year(years)
-{}
-
-void TimeStamp::SaveTo(pugi::xml_node& node) const
-{
-	node.append_attribute("year") = year;
-	node.append_attribute("month") = month;
-	node.append_attribute("day") = day;
-	node.append_attribute("hour") = hour;
-	node.append_attribute("minute") = minute;
-	node.append_attribute("second") = second;
-}
-
-void TimeStamp::LoadFrom(pugi::xml_node& node)
-{
-	year = node.attribute("year").as_int();
-	month = node.attribute("month").as_int();
-	day = node.attribute("day").as_int();
-	hour = node.attribute("hour").as_int();
-	minute = node.attribute("minute").as_int();
-	second = node.attribute("second").as_int();
-}
-
-bool TimeStamp::operator!=(const TimeStamp& wt) const
-{
-	return !(*this == wt);
-}
-
-bool TimeStamp::operator==(const TimeStamp& wt) const
-{
-	return second == wt.second && minute == wt.minute && hour == wt.hour && day == wt.day && month == wt.month &&
-		year == wt.year;
-}
-
 const vector<string>& SyntaxAttributes::GetAttributesList() const
 {
 	return mAttributesList;
@@ -38,23 +38,6 @@ typedef vector<string>                StringsVec;
 
 enum class SyntaxProtectionSection { Public, Private, Protected };
 
-// Date time stamp
-struct TimeStamp
-{
-	int year, month, day, hour, minute, second; 
-
-	TimeStamp(int seconds = 0, int minutes = 0, int hours = 0, int days = 0, int months = 0, int years = 0);
-
-	bool operator==(const TimeStamp& wt) const;
-	bool operator!=(const TimeStamp& wt) const;
-
-	// Saves data to xml node
-	void SaveTo(pugi::xml_node& node) const;
-
-	// Loads data from xml node
-	void LoadFrom(pugi::xml_node& node);
-};
-
 // Abstract syntax tree file
 class SyntaxFile
 {
@@ -71,8 +54,8 @@ public:
 	// Returns file's data
 	const string& GetData() const;
 
-	// Returns file last edit date
-	const TimeStamp& GetLastEditedDate() const;
+	// Returns file data content hash
+	unsigned long long GetDataHash() const;
 
 	// Returns global syntax namespace in this file
 	SyntaxNamespace* GetGlobalNamespace() const;
@@ -83,11 +66,14 @@ public:
 	// Loads data from xml node
 	void LoadFrom(pugi::xml_node& node);
 
+	// Returns content hash of data (64 bit FNV-1a), stable between runs
+	static unsigned long long CalculateDataHash(const string& data);
+
 protected:
-	string           mPath;                      // File path
-	string           mData;                      // File data
-	TimeStamp        mLastEditedDate;            // Last file edited date
-	SyntaxNamespace* mGlobalNamespace = nullptr; // Global syntax namespace in file
+	string             mPath;                      // File path
+	string             mData;                      // File data
+	unsigned long long mDataHash = 0;              // File data content hash, used to check is file changed
+	SyntaxNamespace*   mGlobalNamespace = nullptr; // Global syntax namespace in file
 
 	friend class CppSyntaxParser;
 	friend class CodeToolApplication;
@@ -150,7 +150,7 @@ namespace Editor
 		OnResizing();
 
 		auto widget = EditorUIRoot.GetRootWidget()->GetChildWidget("tools panel/play panel");
-		o2EditorAnimationWindow.SetAnimation(&widget->GetStateObject("playing")->GetAnimationClip(),
+		o2EditorAnimationWindow.SetAnimation(&widget->GetStateObject("playing")->GetEditableAnimationClip(),
 											 &widget->GetStateObject("playing")->player);
 
 		o2EditorAnimationWindow.SetTarget(widget);
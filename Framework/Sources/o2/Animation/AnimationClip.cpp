@@ -75,6 +75,12 @@ namespace o2
 		return mLoop;
 	}
 
+	void AnimationClip::SetTracksBakeSampleRate(float sampleRate)
+	{
+		for (auto track : mTracks)
+			track->SetBakeSampleRate(sampleRate);
+	}
+
 	Vector<IAnimationTrack*>& AnimationClip::GetTracks()
 	{
 		return mTracks;
@@ -50,6 +50,9 @@ namespace o2
 		// Returns loop
 		Loop GetLoop() const;
 
+		// Sets baked samples count per second for all tracks. 0 disables baking
+		void SetTracksBakeSampleRate(float sampleRate);
+
 		// Returns animation tracks
 		Vector<IAnimationTrack*>& GetTracks();
 
@@ -144,7 +147,7 @@ namespace o2
 		for (auto track : mTracks)
 		{
 			if (track->path == path)
-				return dynamic_cast<AnimationTrack<_type>*>(val.animatedValue);
+				return dynamic_cast<AnimationTrack<_type>*>(track);
 		}
 
 		return nullptr;
@@ -249,6 +252,7 @@ CLASS_METHODS_META(o2::AnimationClip)
 	PUBLIC_FUNCTION(float, GetDuration);
 	PUBLIC_FUNCTION(void, SetLoop, Loop);
 	PUBLIC_FUNCTION(Loop, GetLoop);
+	PUBLIC_FUNCTION(void, SetTracksBakeSampleRate, float);
 	PUBLIC_FUNCTION(Vector<IAnimationTrack*>&, GetTracks);
 	PUBLIC_FUNCTION(const Vector<IAnimationTrack*>&, GetTracks);
 	PUBLIC_FUNCTION(bool, ContainsTrack, const String&);
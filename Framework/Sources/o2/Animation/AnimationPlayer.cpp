@@ -10,6 +10,15 @@ namespace o2
 		SetClip(clip);
 	}
 
+	AnimationPlayer::AnimationPlayer(const AnimationPlayer& other):
+		IAnimation(other)
+	{
+		if (other.mClip && other.mClipOwner)
+			SetClip(other.mClip->CloneAs<AnimationClip>(), true);
+		else
+			SetClip(other.mClip);
+	}
+
 	AnimationPlayer::~AnimationPlayer()
 	{
 		for (auto player : mTrackPlayers)
@@ -21,6 +30,29 @@ namespace o2
 			delete mClip;
 	}
 
+	AnimationPlayer& AnimationPlayer::operator=(const AnimationPlayer& other)
+	{
+		if (&other == this)
+			return *this;
+
+		IAnimation::operator=(other);
+
+		AnimationClip* ownedClip = mClipOwner ? mClip : nullptr;
+
+		// Other player can share clip owned by this player, then this player keeps owning it
+		bool keepOwnedClip = ownedClip && other.mClip == ownedClip;
+
+		if (other.mClip && other.mClipOwner)
+			SetClip(other.mClip->CloneAs<AnimationClip>(), true);
+		else
+			SetClip(other.mClip, keepOwnedClip);
+
+		if (ownedClip && !keepOwnedClip)
+			delete ownedClip;
+
+		return *this;
+	}
+
 	void AnimationPlayer::SetTarget(IObject* target, bool errors /*= true*/)
 	{
 		mTarget = target;
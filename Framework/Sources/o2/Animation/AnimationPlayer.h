@@ -19,9 +19,16 @@ namespace o2
 		// Default constructor
 		AnimationPlayer(IObject* target = nullptr, AnimationClip* clip = nullptr);
 
+		// Copy-constructor. Copies playing state and shares clip with other player, clip is cloned only when
+		// other player owns it. Tracks are bound when target is set
+		AnimationPlayer(const AnimationPlayer& other);
+
 		// Destructor
 		~AnimationPlayer();
 
+		// Copy operator. Copies playing state and shares clip with other player, keeps own target
+		AnimationPlayer& operator=(const AnimationPlayer& other);
+
 		// Sets animation target
 		// Bind all animation tracks to target's child fields (if it possible)
 		void SetTarget(IObject* target, bool errors = true);
@@ -12,6 +12,29 @@ namespace o2
 		player.onTrackPlayerRemove = [&](auto track) { OnTrackPlayerRemove(track); };
 	}
 
+	AnimationState::AnimationState(const AnimationState& other):
+		name(other.name), mask(other.mask), blend(other.blend), player(other.player), mAnimation(other.mAnimation),
+		mWeight(other.mWeight)
+	{
+		player.mAnimationState = this;
+		player.onTrackPlayerAdded = [&](auto track) { OnTrackPlayerAdded(track); };
+		player.onTrackPlayerRemove = [&](auto track) { OnTrackPlayerRemove(track); };
+	}
+
+	AnimationState& AnimationState::operator=(const AnimationState& other)
+	{
+		name = other.name;
+		mask = other.mask;
+		blend = other.blend;
+		mAnimation = other.mAnimation;
+		mWeight = other.mWeight;
+
+		player = other.player;
+		player.mAnimationState = this;
+
+		return *this;
+	}
+
 	void AnimationState::SetWeight(float weight)
 	{
 		mWeight = weight;
@@ -31,6 +31,12 @@ namespace o2
 		// Constructor with name
 		AnimationState(const String& name);
 
+		// Copy-constructor. Animation clip is shared with other state, only player state is copied
+		AnimationState(const AnimationState& other);
+
+		// Copy operator. Animation clip is shared with other state, only player state is copied
+		AnimationState& operator=(const AnimationState& other);
+
 		// Sets state weight
 		void SetWeight(float weight);
 
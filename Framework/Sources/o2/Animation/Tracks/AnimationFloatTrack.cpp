@@ -59,6 +59,16 @@ namespace o2
 		return mnew Player();
 	}
 
+	void AnimationTrack<float>::SetBakeSampleRate(float sampleRate)
+	{
+		curve.SetBakeSampleRate(sampleRate);
+	}
+
+	float AnimationTrack<float>::GetBakeSampleRate() const
+	{
+		return curve.GetBakeSampleRate();
+	}
+
 	void AnimationTrack<float>::AddKeys(Vector<Vec2F> values, float smooth /*= 1.0f*/)
 	{
 		curve.AppendKeys(values, smooth);
@@ -50,6 +50,12 @@ namespace o2
 		// Creates track-type specific player
 		IPlayer* CreatePlayer() const override;
 
+		// Sets baked samples count per second. 0 disables baking
+		void SetBakeSampleRate(float sampleRate) override;
+
+		// Returns baked samples count per second, 0 when baking is disabled
+		float GetBakeSampleRate() const override;
+
 		// Adds key with smoothing
 		void AddKeys(Vector<Vec2F> values, float smooth = 1.0f);
 
@@ -236,6 +242,8 @@ CLASS_METHODS_META(o2::AnimationTrack<float>)
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
 	PUBLIC_FUNCTION(IPlayer*, CreatePlayer);
+	PUBLIC_FUNCTION(void, SetBakeSampleRate, float);
+	PUBLIC_FUNCTION(float, GetBakeSampleRate);
 	PUBLIC_FUNCTION(void, AddKeys, Vector<Vec2F>, float);
 	PUBLIC_FUNCTION(int, AddKey, const Key&);
 	PUBLIC_FUNCTION(int, AddKey, const Key&, float);
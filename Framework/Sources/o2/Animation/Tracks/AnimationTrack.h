@@ -5,6 +5,7 @@
 #include "o2/Animation/Tracks/IAnimationTrack.h"
 #include "o2/Utils/Math/Curve.h"
 #include "o2/Utils/Math/Interpolation.h"
+#include "o2/Utils/Math/UniformSamples.h"
 #include "o2/Utils/Memory/MemoryManager.h"
 #include "o2/Utils/Tools/KeySearch.h"
 
@@ -40,6 +41,9 @@ namespace o2
 		// Returns value at time, with cached state
 		_type GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+		// Returns value at time from keys approximation, even when track is baked
+		_type GetValueApproximated(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
+
 		// It is called when beginning keys batch change. After this call all keys modifications will not be update pproximation
 		// Used for optimizing many keys change
 		void BeginKeysBatchChange() override;
@@ -53,6 +57,12 @@ namespace o2
 		// Creates track-type specific player
 		IPlayer* CreatePlayer() const override;
 
+		// Sets baked samples count per second. 0 disables baking
+		void SetBakeSampleRate(float sampleRate) override;
+
+		// Returns baked samples count per second, 0 when baking is disabled
+		float GetBakeSampleRate() const override;
+
 		// Adds key with smoothing
 		void AddKeys(Vector<Key> keys, float smooth = 1.0f);
 
@@ -266,6 +276,9 @@ namespace o2
 
 		Vector<Key> mKeys; // Animation keys @SERIALIZABLE
 
+		float                 mBakeSampleRate = 0.0f; // Baked samples count per second, 0 when baking is disabled @SERIALIZABLE
+		UniformSamples<_type> mBakedValues;           // Baked uniform samples, updated with approximation
+
 	protected:
 		// Returns keys (for property)
 		Vector<Key> GetKeysNonContant();
@@ -273,6 +286,9 @@ namespace o2
 		// Updates keys approximation
 		void UpdateApproximation();
 
+		// Samples track uniformly when baking is enabled, otherwise clears baked samples
+		void UpdateBakedValues();
+
 		// Completion deserialization callback
 		void OnDeserialized(const DataValue& node) override;
 	};
@@ -292,7 +308,8 @@ namespace o2
 
 	template<typename _type>
 	AnimationTrack<_type>::AnimationTrack(const AnimationTrack<_type>& other):
-		IAnimationTrack(other), mKeys(other.mKeys), keys(this)
+		IAnimationTrack(other), mKeys(other.mKeys), mBakeSampleRate(other.mBakeSampleRate), mBakedValues(other.mBakedValues),
+		keys(this)
 	{}
 
 	template<typename _type>
@@ -300,6 +317,8 @@ namespace o2
 	{
 		IAnimationTrack::operator=(other);
 		mKeys = other.mKeys;
+		mBakeSampleRate = other.mBakeSampleRate;
+		mBakedValues = other.mBakedValues;
 
 		onKeysChanged();
 
@@ -315,6 +334,15 @@ namespace o2
 
 	template<typename _type>
 	_type AnimationTrack<_type>::GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
+	{
+		if (!mBakedValues.IsEmpty() && mBakedValues.IsInRange(position))
+			return mBakedValues.Evaluate(position);
+
+		return GetValueApproximated(position, direction, cacheKey, cacheKeyApprox);
+	}
+
+	template<typename _type>
+	_type AnimationTrack<_type>::GetValueApproximated(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
 	{
 		int count = mKeys.Count();
 
@@ -377,6 +405,19 @@ namespace o2
 		return mnew Player();
 	}
 
+	template<typename _type>
+	void AnimationTrack<_type>::SetBakeSampleRate(float sampleRate)
+	{
+		mBakeSampleRate = Math::Max(sampleRate, 0.0f);
+		UpdateBakedValues();
+	}
+
+	template<typename _type>
+	float AnimationTrack<_type>::GetBakeSampleRate() const
+	{
+		return mBakeSampleRate;
+	}
+
 	template<typename _type>
 	void AnimationTrack<_type>::AddKeys(Vector<Key> keys, float smooth /*= 1.0f*/)
 	{
@@ -546,6 +587,7 @@ namespace o2
 	void AnimationTrack<_type>::RemoveAllKeys()
 	{
 		mKeys.Clear();
+		mBakedValues.Clear();
 		onKeysChanged();
 	}
 
@@ -644,9 +686,27 @@ namespace o2
 			}
 		}
 
+		UpdateBakedValues();
+
 		onKeysChanged();
 	}
 
+	template<typename _type>
+	void AnimationTrack<_type>::UpdateBakedValues()
+	{
+		if (mBakeSampleRate <= 0.0f || mKeys.Count() < 2)
+		{
+			mBakedValues.Clear();
+			return;
+		}
+
+		int cacheKey = 0, cacheKeyApprox = 0;
+		mBakedValues.Bake(mKeys[0].position, mKeys.Last().position, mBakeSampleRate, [&](float position)
+		{
+			return GetValueApproximated(position, true, cacheKey, cacheKeyApprox);
+		});
+	}
+
 	template<typename _type>
 	void AnimationTrack<_type>::OnDeserialized(const DataValue& node)
 	{
@@ -897,6 +957,8 @@ CLASS_FIELDS_META(o2::AnimationTrack<_type>)
 	PROTECTED_FIELD(mBatchChange).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mChangedKeys).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mKeys).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakeSampleRate).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedValues);
 }
 END_META;
 META_TEMPLATES(typename _type)
@@ -905,10 +967,13 @@ CLASS_METHODS_META(o2::AnimationTrack<_type>)
 
 	PUBLIC_FUNCTION(_type, GetValue, float);
 	PUBLIC_FUNCTION(_type, GetValue, float, bool, int&, int&);
+	PUBLIC_FUNCTION(_type, GetValueApproximated, float, bool, int&, int&);
 	PUBLIC_FUNCTION(void, BeginKeysBatchChange);
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
 	PUBLIC_FUNCTION(IPlayer*, CreatePlayer);
+	PUBLIC_FUNCTION(void, SetBakeSampleRate, float);
+	PUBLIC_FUNCTION(float, GetBakeSampleRate);
 	PUBLIC_FUNCTION(void, AddKeys, Vector<Key>, float);
 	PUBLIC_FUNCTION(int, AddKey, const Key&);
 	PUBLIC_FUNCTION(int, AddKey, const Key&, float);
@@ -933,6 +998,7 @@ CLASS_METHODS_META(o2::AnimationTrack<_type>)
 	PUBLIC_STATIC_FUNCTION(AnimationTrack<_type>, Linear, const _type&, const _type&, float);
 	PROTECTED_FUNCTION(Vector<Key>, GetKeysNonContant);
 	PROTECTED_FUNCTION(void, UpdateApproximation);
+	PROTECTED_FUNCTION(void, UpdateBakedValues);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
@@ -2,6 +2,7 @@
 #include "AnimationVec2FTrack.h"
 
 #include "o2/Animation/AnimationState.h"
+#include "o2/EngineSettings.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Math/Interpolation.h"
@@ -13,13 +14,15 @@ namespace o2
 	{}
 
 	AnimationTrack<Vec2F>::AnimationTrack(const AnimationTrack<Vec2F>& other) :
-		IAnimationTrack(other), mKeys(other.mKeys)
+		IAnimationTrack(other), mKeys(other.mKeys), mBakeSampleRate(other.mBakeSampleRate), mBakedValues(other.mBakedValues)
 	{}
 
 	AnimationTrack<Vec2F>& AnimationTrack<Vec2F>::operator=(const AnimationTrack<Vec2F>& other)
 	{
 		IAnimationTrack::operator =(other);
 		mKeys = other.mKeys;
+		mBakeSampleRate = other.mBakeSampleRate;
+		mBakedValues = other.mBakedValues;
 
 		onKeysChanged();
 
@@ -33,6 +36,31 @@ namespace o2
 	}
 
 	Vec2F AnimationTrack<Vec2F>::GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
+	{
+		if (!mBakedValues.IsEmpty() && mBakedValues.IsInRange(position))
+			return mBakedValues.Evaluate(position);
+
+		return GetValueApproximated(position, direction, cacheKey, cacheKeyApprox);
+	}
+
+	float AnimationTrack<Vec2F>::GetBakedMaxError() const
+	{
+		int samplesCount = mBakedValues.GetSamplesCount();
+		float begin = mBakedValues.GetBegin(), step = mBakedValues.GetStep();
+
+		float maxError = 0.0f;
+		int cacheKey = 0, cacheKeyApprox = 0;
+		for (int i = 0; i < samplesCount - 1; i++)
+		{
+			float position = begin + step*((float)i + 0.5f);
+			float error = (mBakedValues.Evaluate(position) - GetValueApproximated(position, true, cacheKey, cacheKeyApprox)).Length();
+			maxError = Math::Max(maxError, error);
+		}
+
+		return maxError;
+	}
+
+	Vec2F AnimationTrack<Vec2F>::GetValueApproximated(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
 	{
 		int count = mKeys.Count();
 
@@ -124,6 +152,17 @@ namespace o2
 		return mnew Player();
 	}
 
+	void AnimationTrack<Vec2F>::SetBakeSampleRate(float sampleRate)
+	{
+		mBakeSampleRate = Math::Max(sampleRate, 0.0f);
+		UpdateBakedValues();
+	}
+
+	float AnimationTrack<Vec2F>::GetBakeSampleRate() const
+	{
+		return mBakeSampleRate;
+	}
+
 	void AnimationTrack<Vec2F>::AddKeys(Vector<Key> keys, float smooth /*= 1.0f*/)
 	{
 		for (auto key : keys)
@@ -238,6 +277,7 @@ namespace o2
 	void AnimationTrack<Vec2F>::RemoveAllKeys()
 	{
 		mKeys.Clear();
+		mBakedValues.Clear();
 		onKeysChanged();
 	}
 
@@ -401,9 +441,36 @@ namespace o2
 			endKey.mApproxTotalLength = totalLength;
 		}
 
+		UpdateBakedValues();
+
 		onKeysChanged();
 	}
 
+	void AnimationTrack<Vec2F>::UpdateBakedValues()
+	{
+		if (mBakeSampleRate <= 0.0f || mKeys.Count() < 2)
+		{
+			mBakedValues.Clear();
+			return;
+		}
+
+		int cacheKey = 0, cacheKeyApprox = 0;
+		mBakedValues.Bake(mKeys[0].position, mKeys.Last().position, mBakeSampleRate, [&](float position)
+		{
+			return GetValueApproximated(position, true, cacheKey, cacheKeyApprox);
+		});
+
+#if BAKED_VALUES_CHECK
+		float valuesRange = 0.0f;
+		for (auto& key : mKeys)
+			valuesRange = Math::Max(valuesRange, (key.value - mKeys[0].value).Length());
+
+		float maxError = GetBakedMaxError();
+		if (maxError > GetBakedValuesMaxRelativeError()*Math::Max(valuesRange, 1.0f))
+			o2Debug.LogWarning("Baked animation track error %f is too large for sample rate %f", maxError, mBakeSampleRate);
+#endif
+	}
+
 	void AnimationTrack<Vec2F>::OnDeserialized(const DataValue& node)
 	{
 		UpdateApproximation();
@@ -35,6 +35,13 @@ namespace o2
 		// Returns value at time
 		Vec2F GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+		// Returns value at time from keys approximation, even when track is baked
+		Vec2F GetValueApproximated(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
+
+		// Returns max distance between baked and approximated values. It is measured in the middles between samples,
+		// where lerp error is largest. Returns 0 when track isn't baked
+		float GetBakedMaxError() const;
+
 		// It is called when beginning keys batch change. After this call all keys modifications will not be update pproximation
 		// Used for optimizing many keys change
 		void BeginKeysBatchChange() override;
@@ -48,6 +55,12 @@ namespace o2
 		// Creates track-type specific player
 		IPlayer* CreatePlayer() const override;
 
+		// Sets baked samples count per second. 0 disables baking
+		void SetBakeSampleRate(float sampleRate) override;
+
+		// Returns baked samples count per second, 0 when baking is disabled
+		float GetBakeSampleRate() const override;
+
 		// Adds key with smoothing
 		void AddKeys(Vector<Key> keys, float smooth = 1.0f);
 
@@ -267,6 +280,9 @@ namespace o2
 
 		Vector<Key> mKeys; // Animation keys @SERIALIZABLE
 
+		float                 mBakeSampleRate = 0.0f; // Baked samples count per second, 0 when baking is disabled @SERIALIZABLE
+		UniformSamples<Vec2F> mBakedValues;           // Baked uniform samples, updated with approximation
+
 	protected:
 		// Returns keys (for property)
 		Vector<Key> GetKeysNonContant();
@@ -274,6 +290,9 @@ namespace o2
 		// Updates keys approximation
 		void UpdateApproximation();
 
+		// Samples track uniformly when baking is enabled, otherwise clears baked samples
+		void UpdateBakedValues();
+
 		// Completion deserialization callback
 		void OnDeserialized(const DataValue& node) override;
 	};
@@ -290,6 +309,8 @@ CLASS_FIELDS_META(o2::AnimationTrack<o2::Vec2F>)
 	PROTECTED_FIELD(mBatchChange).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mChangedKeys).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mKeys).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakeSampleRate).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedValues);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationTrack<o2::Vec2F>)
@@ -297,10 +318,14 @@ CLASS_METHODS_META(o2::AnimationTrack<o2::Vec2F>)
 
 	PUBLIC_FUNCTION(Vec2F, GetValue, float);
 	PUBLIC_FUNCTION(Vec2F, GetValue, float, bool, int&, int&);
+	PUBLIC_FUNCTION(Vec2F, GetValueApproximated, float, bool, int&, int&);
+	PUBLIC_FUNCTION(float, GetBakedMaxError);
 	PUBLIC_FUNCTION(void, BeginKeysBatchChange);
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
 	PUBLIC_FUNCTION(IPlayer*, CreatePlayer);
+	PUBLIC_FUNCTION(void, SetBakeSampleRate, float);
+	PUBLIC_FUNCTION(float, GetBakeSampleRate);
 	PUBLIC_FUNCTION(void, AddKeys, Vector<Key>, float);
 	PUBLIC_FUNCTION(int, AddKey, const Key&);
 	PUBLIC_FUNCTION(int, AddKey, const Key&, float);
@@ -325,6 +350,7 @@ CLASS_METHODS_META(o2::AnimationTrack<o2::Vec2F>)
 	PUBLIC_STATIC_FUNCTION(AnimationTrack<Vec2F>, Linear, const Vec2F&, const Vec2F&, float);
 	PROTECTED_FUNCTION(Vector<Key>, GetKeysNonContant);
 	PROTECTED_FUNCTION(void, UpdateApproximation);
+	PROTECTED_FUNCTION(void, UpdateBakedValues);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
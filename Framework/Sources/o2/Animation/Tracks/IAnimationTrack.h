@@ -79,6 +79,15 @@ namespace o2
 		// Creates track-type specific player
 		virtual IPlayer* CreatePlayer() const { return nullptr; }
 
+		// Sets baked samples count per second. Baked track is sampled uniformly on each keys change and players
+		// evaluate it by direct index lookup and lerp instead of keys search. 0 disables baking.
+		// Baked track isn't exact on discontinuous keys: instant value changes are played as transitions lasting
+		// one sample
+		virtual void SetBakeSampleRate(float sampleRate) {}
+
+		// Returns baked samples count per second, 0 when baking is disabled
+		virtual float GetBakeSampleRate() const { return 0; }
+
 		SERIALIZABLE(IAnimationTrack);
 	};
 };
@@ -103,6 +112,8 @@ CLASS_METHODS_META(o2::IAnimationTrack)
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
 	PUBLIC_FUNCTION(IPlayer*, CreatePlayer);
+	PUBLIC_FUNCTION(void, SetBakeSampleRate, float);
+	PUBLIC_FUNCTION(float, GetBakeSampleRate);
 }
 END_META;
 
@@ -15,10 +15,12 @@
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
 #include "o2/Utils/Debug/Log/FileLogStream.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 #include "o2/Utils/Tasks/TaskManager.h"
 
 namespace o2
@@ -82,6 +84,9 @@ namespace o2
 
 		mProjectConfig = mnew ProjectConfig();
 
+		// Job system is used by assets building
+		mJobSystem = mnew JobSystem();
+
 		mAssets = mnew Assets();
 
 		mInput = mnew Input();
@@ -115,6 +120,7 @@ namespace o2
 		delete mAssets;
 		delete mEventSystem;
 		delete mTaskManager;
+		delete mJobSystem;
 	}
 
 	void Application::ProcessFrame()
@@ -135,46 +141,119 @@ namespace o2
 			realdDt = maxFPSDeltaTime;
 		}
 
-		float dt = Math::Clamp(realdDt, 0.001f, 0.05f);
-
-		mInput->PreUpdate();
-
-		mTime->Update(realdDt);
-		o2Debug.Update(dt);
-		mTaskManager->Update(dt);
-		UpdateEventSystem();
+		if constexpr (PROFILER_ENABLED)
+			o2Profiler.BeginFrame();
 
-		mRender->Begin();
-
-		OnUpdate(dt);
-		UpdateScene(dt);
-
-		mAccumulatedDT += dt;
-		float fixedDT = 1.0f/(float)fixedFPS;
-		while (mAccumulatedDT > fixedDT)
 		{
-			OnFixedUpdate(fixedDT);
-			FixedUpdateScene(fixedDT);
-
-			PreUpdatePhysics();
-			UpdatePhysics(fixedDT);
-			PostUpdatePhysics();
-
-			mAccumulatedDT -= fixedDT;
+			PROFILE_SCOPE("Frame");
+
+			float dt = Math::Clamp(realdDt, 0.001f, 0.05f);
+
+			{
+				PROFILE_SCOPE("Input pre update");
+				mInput->PreUpdate();
+			}
+
+			{
+				PROFILE_SCOPE("Time update");
+				mTime->Update(realdDt);
+			}
+
+			{
+				PROFILE_SCOPE("Debug update");
+				o2Debug.Update(dt);
+			}
+
+			{
+				PROFILE_SCOPE("Tasks update");
+				mTaskManager->Update(dt);
+			}
+
+			{
+				PROFILE_SCOPE("Assets update");
+				mAssets->Update();
+			}
+
+			{
+				PROFILE_SCOPE("Event system update");
+				UpdateEventSystem();
+			}
+
+			mRender->Begin();
+
+			{
+				PROFILE_SCOPE("Update");
+				OnUpdate(dt);
+			}
+
+			{
+				PROFILE_SCOPE("Scene update");
+				UpdateScene(dt);
+			}
+
+			{
+				PROFILE_SCOPE("Fixed update");
+
+				mAccumulatedDT += dt;
+				float fixedDT = 1.0f/(float)fixedFPS;
+				while (mAccumulatedDT > fixedDT)
+				{
+					OnFixedUpdate(fixedDT);
+					FixedUpdateScene(fixedDT);
+
+					{
+						PROFILE_SCOPE("Physics update");
+
+						PreUpdatePhysics();
+						UpdatePhysics(fixedDT);
+						PostUpdatePhysics();
+					}
+
+					mAccumulatedDT -= fixedDT;
+				}
+			}
+
+			{
+				PROFILE_SCOPE("Event system post update");
+				PostUpdateEventSystem();
+			}
+
+			{
+				PROFILE_SCOPE("Draw");
+
+				OnDraw();
+				DrawScene();
+			}
+
+			{
+				PROFILE_SCOPE("UI draw");
+				DrawUIManager();
+			}
+
+			if constexpr (PROFILER_ENABLED)
+			{
+				if (o2Profiler.IsOverlayEnabled())
+					o2Profiler.DrawOverlay();
+			}
+
+			{
+				PROFILE_SCOPE("Debug draw");
+				o2Debug.Draw();
+			}
+
+			{
+				PROFILE_SCOPE("Render end");
+				mRender->End();
+			}
+
+			{
+				PROFILE_SCOPE("Input update");
+				mInput->Update(dt);
+			}
 		}
 
-		PostUpdateEventSystem();
-
-		OnDraw();
-		DrawScene();
-
-		DrawUIManager();
-
-		o2Debug.Draw();
-
-		mRender->End();
-
-		mInput->Update(dt);
+		if constexpr (PROFILER_ENABLED)
+			o2Profiler.EndFrame();
 	}
 
 	void Application::DrawScene()
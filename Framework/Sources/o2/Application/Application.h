@@ -8,6 +8,8 @@
 
 #if defined PLATFORM_WINDOWS
 #include "o2/Application/Windows/ApplicationBase.h"
+#elif defined PLATFORM_LINUX
+#include "o2/Application/Linux/ApplicationBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Application/Android/ApplicationBase.h"
 #include <jni.h>
@@ -23,6 +25,7 @@ namespace o2
 	class EventSystem;
 	class FileSystem;
 	class Input;
+	class JobSystem;
 	class LogStream;
 	class PhysicsWorld;
 	class ProjectConfig;
@@ -147,7 +150,7 @@ namespace o2
 		// Returns is application ready to use
 		static bool IsReady();
 
-#if defined PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS || defined PLATFORM_LINUX
 
 		// Initializes engine application
 		virtual void Initialize();
@@ -176,6 +179,7 @@ namespace o2
 		EventSystem*   mEventSystem = nullptr;   // Events processing system
 		FileSystem*    mFileSystem = nullptr;    // File system
 		Input*         mInput = nullptr;         // While application user input message
+		JobSystem*     mJobSystem = nullptr;     // Multithreaded jobs system
 		LogStream*     mLog = nullptr;           // Log stream with id "app", using only for application messages
 		PhysicsWorld*  mPhysics = nullptr;       // Physics
 		ProjectConfig* mProjectConfig = nullptr; // Project config
@@ -0,0 +1,45 @@
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	class Application;
+
+	// ------------------------------------------------------------------------------------
+	// Linux headless application base fields. There is no window, window parameters are
+	// only stored. Frames are processed in loop until Shutdown() or frames limit reached
+	// ------------------------------------------------------------------------------------
+	class ApplicationBase
+	{
+	protected:
+		Vec2I  mWindowedSize = Vec2I(800, 600); // Size of virtual window content
+		Vec2I  mWindowedPos;                    // Position of virtual window
+		String mWndCaption;                     // Virtual window caption
+		bool   mWindowed = true;                // True if app in windowed mode, false if in fullscreen mode
+		bool   mWindowResizible = true;         // True, if window can be sized by user
+		bool   mMaximized = false;              // True, if virtual window is maximized
+
+		bool   mRunning = false;      // True, when application cycle is processing frames
+		UInt64 mFramesLimit = 0;      // Count of frames to process in application cycle. Zero means unlimited
+		UInt64 mProcessedFrames = 0;  // Count of processed frames in application cycle
+
+	public:
+		// Sets count of frames to process in application cycle. Zero means unlimited, until Shutdown() call
+		void SetFramesLimit(UInt64 framesLimit) { mFramesLimit = framesLimit; }
+
+		// Returns count of frames to process in application cycle
+		UInt64 GetFramesLimit() const { return mFramesLimit; }
+
+		// Returns count of processed frames in application cycle
+		UInt64 GetProcessedFramesCount() const { return mProcessedFrames; }
+
+		friend class Render;
+		friend class FileSystem;
+	};
+}
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,159 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Application/Application.h"
+#include "o2/Events/EventSystem.h"
+#include "o2/Render/Render.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include <limits.h>
+#include <unistd.h>
+
+namespace o2
+{
+	void Application::Initialize()
+	{
+		BasicInitialize();
+	}
+
+	void Application::InitializePlatform()
+	{
+		mLog->Out("Initializing headless application, virtual window %ix%i", mWindowedSize.x, mWindowedSize.y);
+	}
+
+	void Application::Shutdown()
+	{
+		mRunning = false;
+	}
+
+	void Application::SetFullscreen(bool fullscreen /*= true*/)
+	{
+		mWindowed = !fullscreen;
+	}
+
+	void Application::CheckCursorInfiniteMode()
+	{}
+
+	void Application::Launch()
+	{
+		mLog->Out("Application launched!");
+
+		OnStarted();
+		onStarted.Invoke();
+		o2Events.OnApplicationStarted();
+
+		mRunning = true;
+		mProcessedFrames = 0;
+
+		while (mRunning)
+		{
+			ProcessFrame();
+			mProcessedFrames++;
+
+			if (mFramesLimit > 0 && mProcessedFrames >= mFramesLimit)
+				mRunning = false;
+		}
+
+		o2Events.OnApplicationClosing();
+		OnClosing();
+		onClosing.Invoke();
+	}
+
+	bool Application::IsFullScreen() const
+	{
+		return !mWindowed;
+	}
+
+	void Application::Maximize()
+	{
+		mMaximized = true;
+	}
+
+	bool Application::IsMaximized() const
+	{
+		return mMaximized;
+	}
+
+	void Application::SetResizible(bool resizible)
+	{
+		mWindowResizible = resizible;
+	}
+
+	bool Application::IsResizible() const
+	{
+		return mWindowResizible;
+	}
+
+	void Application::SetWindowSize(const Vec2I& size)
+	{
+		SetContentSize(size);
+	}
+
+	Vec2I Application::GetWindowSize() const
+	{
+		return mWindowedSize;
+	}
+
+	void Application::SetWindowPosition(const Vec2I& position)
+	{
+		mWindowedPos = position;
+	}
+
+	Vec2I Application::GetWindowPosition() const
+	{
+		return mWindowedPos;
+	}
+
+	void Application::SetWindowCaption(const String& caption)
+	{
+		mWndCaption = caption;
+	}
+
+	String Application::GetWindowCaption() const
+	{
+		return mWndCaption;
+	}
+
+	void Application::SetContentSize(const Vec2I& size)
+	{
+		mWindowedSize = size;
+
+		mLog->Out("Set Content Size: %ix%i", size.x, size.y);
+
+		if (mRender)
+			mRender->OnFrameResized();
+
+		onResizing();
+		OnResizing();
+	}
+
+	Vec2I Application::GetContentSize() const
+	{
+		return mWindowedSize;
+	}
+
+	Vec2I Application::GetScreenResolution() const
+	{
+		return mWindowedSize;
+	}
+
+	void Application::SetCursor(CursorType type)
+	{}
+
+	void Application::SetCursorPosition(const Vec2F& position)
+	{}
+
+	String Application::GetBinPath() const
+	{
+		char path[PATH_MAX];
+		ssize_t length = readlink("/proc/self/exe", path, PATH_MAX - 1);
+		if (length < 0)
+			return "";
+
+		path[length] = '\0';
+		return o2FileSystem.CanonicalizePath(o2FileSystem.GetParentPath((String)path));
+	}
+}
+
+#endif // PLATFORM_LINUX
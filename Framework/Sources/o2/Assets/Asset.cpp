@@ -63,6 +63,11 @@ namespace o2
 		return mInfo;
 	}
 
+	bool Asset::IsLoaded() const
+	{
+		return !mIsLoading;
+	}
+
 	void Asset::Load(const String& path)
 	{
 		auto info = o2Assets.GetAssetInfo(path);
@@ -166,6 +171,16 @@ namespace o2
 		data.SaveToFile(path);
 	}
 
+	void Asset::ReadDataAsync(const String& path, DataDocument& data)
+	{
+		data.LoadFromFile(path);
+	}
+
+	void Asset::CompleteDataLoading(const String& path, DataDocument& data)
+	{
+		Deserialize(data);
+	}
+
 }
 
 DECLARE_CLASS(o2::Asset);
@@ -54,6 +54,9 @@ namespace o2
 		// Returns asset info
 		const AssetInfo& GetInfo() const;
 
+		// Returns true when asset data is loaded. Asynchronously loading asset isn't loaded until loading is completed
+		bool IsLoaded() const;
+
 		// Loads asset from path
 		void Load(const String& path);
 
@@ -86,7 +89,8 @@ namespace o2
 	protected:
 		PROPERTY(AssetMeta*, mMeta, SetMeta, GetMeta); // @EDITOR_PROPERTY @DONT_DELETE @EXPANDED_BY_DEFAULT @NO_HEADER
 
-		AssetInfo mInfo; // Asset info 
+		AssetInfo mInfo;              // Asset info 
+		bool      mIsLoading = false; // Is asset loading asynchronously, data isn't ready yet
 
 	private:
 		// Hidden default constructor
@@ -120,6 +124,17 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		virtual void SaveData(const String& path) const;
 
+		// Prepares asynchronous reading on main thread, before ReadDataAsync is called. Collects main thread systems
+		// state, which is needed for reading
+		virtual void PrepareDataReading() {}
+
+		// Reads asset data on worker thread when asset is loading asynchronously. Must not use render, scene and other
+		// main thread systems. By default loads data document, it is deserialized in CompleteDataLoading
+		virtual void ReadDataAsync(const String& path, DataDocument& data);
+
+		// Completes asynchronous loading on main thread with data read in ReadDataAsync
+		virtual void CompleteDataLoading(const String& path, DataDocument& data);
+
 		friend class AssetRef;
 		friend class Assets;
 		friend class AssetsBuilder;
@@ -166,6 +181,7 @@ CLASS_FIELDS_META(o2::Asset)
 	PUBLIC_FIELD(meta);
 	PUBLIC_FIELD(mMeta).DONT_DELETE_ATTRIBUTE().EDITOR_PROPERTY_ATTRIBUTE().EXPANDED_BY_DEFAULT_ATTRIBUTE().NO_HEADER_ATTRIBUTE();
 	PROTECTED_FIELD(mInfo);
+	PROTECTED_FIELD(mIsLoading).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::Asset)
@@ -178,6 +194,7 @@ CLASS_METHODS_META(o2::Asset)
 	PUBLIC_FUNCTION(const UID&, GetUID);
 	PUBLIC_FUNCTION(AssetMeta*, GetMeta);
 	PUBLIC_FUNCTION(const AssetInfo&, GetInfo);
+	PUBLIC_FUNCTION(bool, IsLoaded);
 	PUBLIC_FUNCTION(void, Load, const String&);
 	PUBLIC_FUNCTION(void, Load, const UID&);
 	PUBLIC_FUNCTION(void, Save, const String&, bool);
@@ -194,6 +211,9 @@ CLASS_METHODS_META(o2::Asset)
 	PROTECTED_FUNCTION(void, Load, const AssetInfo&);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, PrepareDataReading);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 }
 END_META;
 
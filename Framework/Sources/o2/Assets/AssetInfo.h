@@ -14,8 +14,9 @@ namespace o2
 	{
 		const AssetsTree* tree = nullptr; // Owner asset tree
 		
-		String    path;     // Path of asset @SERIALIZABLE
-		TimeStamp editTime; // Asset edited time @SERIALIZABLE		
+		String    path;            // Path of asset @SERIALIZABLE
+		TimeStamp editTime;        // Asset edited time @SERIALIZABLE
+		UInt64    contentHash = 0; // Asset file content hash, zero for folders @SERIALIZABLE
 
 		AssetMeta* meta = nullptr; // Asset meta data @SERIALIZABLE
 
@@ -84,6 +85,7 @@ CLASS_FIELDS_META(o2::AssetInfo)
 	PUBLIC_FIELD(tree).DEFAULT_VALUE(nullptr);
 	PUBLIC_FIELD(path).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(editTime).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(contentHash).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(meta).DEFAULT_VALUE(nullptr).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(parent).DEFAULT_VALUE(nullptr);
 	PUBLIC_FIELD(children).SERIALIZABLE_ATTRIBUTE();
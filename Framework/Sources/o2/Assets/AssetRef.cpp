@@ -137,6 +137,17 @@ namespace o2
 		return mAssetPtr != nullptr;
 	}
 
+	bool AssetRef::IsLoaded() const
+	{
+		return mAssetPtr && mAssetPtr->IsLoaded();
+	}
+
+	void AssetRef::CompleteLoading()
+	{
+		if (mAssetPtr && !mAssetPtr->IsLoaded())
+			o2Assets.CompleteAsyncLoadingNow(mAssetPtr);
+	}
+
 	Asset* AssetRef::Get()
 	{
 		return mAssetPtr;
@@ -219,6 +230,11 @@ namespace o2
 		return mAssetOwner;
 	}
 
+	int AssetRef::GetReferencesCount() const
+	{
+		return mAssetPtr && mRefCounter ? *mRefCounter : 0;
+	}
+
 	bool AssetRef::operator!=(const AssetRef& other) const
 	{
 		return mAssetPtr != other.mAssetPtr;
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "o2/Assets/Asset.h"
-#include "o2/Assets/Assets.h"
 #include "o2/Utils/Types/Ref.h"
 
 namespace o2
@@ -57,6 +56,12 @@ namespace o2
 		// Returns is reference is valid
 		bool IsValid() const;
 
+		// Returns true when asset is loaded. Asynchronously loading asset isn't loaded until loading is completed
+		bool IsLoaded() const;
+
+		// Completes asynchronous asset loading right now on current thread. Does nothing when asset is loaded
+		void CompleteLoading();
+
 		// Returns asset
 		Asset* Get();
 
@@ -82,6 +87,9 @@ namespace o2
 		// Is asset instance owner
 		bool IsInstance() const;
 
+		// Returns count of references to asset, including this. Instance with more than one reference is shared
+		int GetReferencesCount() const;
+
 		SERIALIZABLE(AssetRef);
 
 	protected:
@@ -161,7 +169,7 @@ namespace o2
 
 		// Creates asset and returns reference
 		template<typename ... _args>
-		static Ref<T> CreateAsset(_args ... args) { return o2Assets.CreateAsset<T>(args ...); }
+		static Ref<T> CreateAsset(_args ... args);
 
 	public:
 		typedef Ref<T, typename std::enable_if<std::is_base_of<Asset, T>::value>::type> _thisType;
@@ -222,6 +230,8 @@ CLASS_METHODS_META(o2::AssetRef)
 {
 
 	PUBLIC_FUNCTION(bool, IsValid);
+	PUBLIC_FUNCTION(bool, IsLoaded);
+	PUBLIC_FUNCTION(void, CompleteLoading);
 	PUBLIC_FUNCTION(Asset*, Get);
 	PUBLIC_FUNCTION(const Asset*, Get);
 	PUBLIC_FUNCTION(const Type&, GetAssetType);
@@ -230,8 +240,21 @@ CLASS_METHODS_META(o2::AssetRef)
 	PUBLIC_FUNCTION(void, RemoveInstance);
 	PUBLIC_FUNCTION(void, SaveInstance, const String&);
 	PUBLIC_FUNCTION(bool, IsInstance);
+	PUBLIC_FUNCTION(int, GetReferencesCount);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, UpdateSpecAsset);
 }
 END_META;
+
+#include "o2/Assets/Assets.h"
+
+namespace o2
+{
+	template<typename T>
+	template<typename ... _args>
+	Ref<T> Ref<T, typename std::enable_if<std::is_base_of<Asset, T>::value>::type>::CreateAsset(_args ... args)
+	{
+		return o2Assets.CreateAsset<T>(args ...);
+	}
+}
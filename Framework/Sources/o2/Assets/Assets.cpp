@@ -31,6 +31,14 @@ namespace o2
 
 	Assets::~Assets()
 	{
+		for (auto request : mAsyncLoadingRequests)
+		{
+			if (request->isStarted)
+				request->readingJob.Wait();
+
+			delete request;
+		}
+
 		delete mAssetsBuilder;
 	}
 
@@ -117,6 +125,8 @@ namespace o2
 			mCachedAssetsByPath[cached->asset->GetPath()] = cached;
 			mCachedAssetsByUID[cached->asset->GetUID()] = cached;
 		}
+		else if (cached->asset->mIsLoading)
+			CompleteAsyncLoadingNow(cached->asset);
 
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
@@ -142,10 +152,89 @@ namespace o2
 			mCachedAssetsByPath[cached->asset->GetPath()] = cached;
 			mCachedAssetsByUID[cached->asset->GetUID()] = cached;
 		}
+		else if (cached->asset->mIsLoading)
+			CompleteAsyncLoadingNow(cached->asset);
+
+		return AssetRef(cached->asset, &cached->referencesCount);
+	}
+
+	AssetRef Assets::LoadAssetAsync(const String& path, int priority /*= 0*/)
+	{
+		if (!JobSystem::IsSingletonInitialzed())
+			return GetAssetRef(path);
+
+		auto cached = FindAssetCache(path);
+
+		if (!cached)
+		{
+			auto& assetInfo = GetAssetInfo(path);
+			if (!assetInfo.IsValid())
+				return AssetRef();
+
+			cached = AddAsyncLoadingRequest(assetInfo, priority);
+		}
+		else if (auto request = FindAsyncLoadingRequest(cached->asset))
+			request->priority = Math::Max(request->priority, priority);
 
 		return AssetRef(cached->asset, &cached->referencesCount);
 	}
 
+	AssetRef Assets::LoadAssetAsync(const UID& id, int priority /*= 0*/)
+	{
+		if (!JobSystem::IsSingletonInitialzed())
+			return GetAssetRef(id);
+
+		auto cached = FindAssetCache(id);
+
+		if (!cached)
+		{
+			auto& assetInfo = GetAssetInfo(id);
+			if (!assetInfo.IsValid())
+				return AssetRef();
+
+			cached = AddAsyncLoadingRequest(assetInfo, priority);
+		}
+		else if (auto request = FindAsyncLoadingRequest(cached->asset))
+			request->priority = Math::Max(request->priority, priority);
+
+		return AssetRef(cached->asset, &cached->referencesCount);
+	}
+
+	int Assets::GetAsyncLoadingRequestsCount() const
+	{
+		return mAsyncLoadingRequests.Count();
+	}
+
+	void Assets::Update()
+	{
+		if (mAsyncLoadingRequests.IsEmpty())
+			return;
+
+		Vector<AsyncLoadingRequest*> completingRequests, cancelingRequests;
+		for (auto request : mAsyncLoadingRequests)
+		{
+			if (request->isStarted && !request->readingJob.IsDone())
+				continue;
+
+			if (request->cache->referencesCount <= 0)
+				cancelingRequests.Add(request);
+			else if (request->isStarted)
+				completingRequests.Add(request);
+		}
+
+		for (auto request : cancelingRequests)
+			CancelAsyncLoading(request);
+
+		// Completing asset can complete other requests synchronously when it requires them
+		for (auto request : completingRequests)
+		{
+			if (mAsyncLoadingRequests.Contains(request))
+				CompleteAsyncLoading(request);
+		}
+
+		StartAsyncLoadingJobs();
+	}
+
 	bool Assets::IsAssetExist(const String& path) const
 	{
 		return GetAssetInfo(path).meta->ID() != UID::empty;
@@ -475,6 +564,8 @@ namespace o2
 
 	void Assets::ClearAssetsCache()
 	{
+		CompleteAllAsyncLoading();
+
 		auto cached = mCachedAssets;
 		mCachedAssets.Clear();
 		mCachedAssetsByPath.Clear();
@@ -521,6 +612,126 @@ namespace o2
 		}
 	}
 
+	Assets::AssetCache* Assets::AddAsyncLoadingRequest(const AssetInfo& info, int priority)
+	{
+		Asset* asset = (Asset*)info.meta->GetAssetType()->CreateSample();
+		asset->mInfo = info;
+		asset->mIsLoading = true;
+
+		auto cached = mnew AssetCache();
+		cached->asset = asset;
+		cached->referencesCount = 0;
+
+		mCachedAssets.Add(cached);
+		mCachedAssetsByPath[cached->asset->GetPath()] = cached;
+		mCachedAssetsByUID[cached->asset->GetUID()] = cached;
+
+		auto request = mnew AsyncLoadingRequest();
+		request->cache = cached;
+		request->path = asset->GetBuiltFullPath();
+		request->priority = priority;
+
+		mAsyncLoadingRequests.Add(request);
+
+		return cached;
+	}
+
+	Assets::AsyncLoadingRequest* Assets::FindAsyncLoadingRequest(Asset* asset) const
+	{
+		return mAsyncLoadingRequests.FindOrDefault([&](AsyncLoadingRequest* request) { return request->cache->asset == asset; });
+	}
+
+	void Assets::StartAsyncLoadingJobs()
+	{
+		int maxJobsCount = Math::Max(1, o2Jobs.GetWorkersCount());
+		int runningJobsCount = mAsyncLoadingRequests.Count([](AsyncLoadingRequest* request) {
+			return request->isStarted && !request->readingJob.IsDone();
+		});
+
+		while (runningJobsCount < maxJobsCount)
+		{
+			AsyncLoadingRequest* nextRequest = nullptr;
+			for (auto request : mAsyncLoadingRequests)
+			{
+				if (request->isStarted || request->cache->referencesCount <= 0)
+					continue;
+
+				if (!nextRequest || request->priority > nextRequest->priority)
+					nextRequest = request;
+			}
+
+			if (!nextRequest)
+				break;
+
+			StartAsyncLoadingJob(nextRequest);
+			runningJobsCount++;
+		}
+	}
+
+	void Assets::StartAsyncLoadingJob(AsyncLoadingRequest* request)
+	{
+		request->isStarted = true;
+
+		Asset* asset = request->cache->asset;
+		asset->PrepareDataReading();
+		o2Jobs.Run([=]() { asset->ReadDataAsync(request->path, request->data); }, &request->readingJob);
+	}
+
+	void Assets::CompleteAsyncLoadingNow(Asset* asset)
+	{
+		auto request = FindAsyncLoadingRequest(asset);
+		if (!request)
+			return;
+
+		if (request->isStarted)
+			request->readingJob.Wait();
+		else
+		{
+			request->isStarted = true;
+			asset->PrepareDataReading();
+			asset->ReadDataAsync(request->path, request->data);
+		}
+
+		CompleteAsyncLoading(request);
+	}
+
+	void Assets::CompleteAsyncLoading(AsyncLoadingRequest* request)
+	{
+		mAsyncLoadingRequests.Remove(request);
+
+		Asset* asset = request->cache->asset;
+		asset->mIsLoading = false;
+		asset->CompleteDataLoading(request->path, request->data);
+
+		delete request;
+	}
+
+	void Assets::CancelAsyncLoading(AsyncLoadingRequest* request)
+	{
+		mAsyncLoadingRequests.Remove(request);
+
+		RemoveAssetCache(request->cache->asset);
+		delete request->cache;
+
+		delete request;
+	}
+
+	void Assets::CompleteAllAsyncLoading()
+	{
+		while (!mAsyncLoadingRequests.IsEmpty())
+		{
+			auto request = mAsyncLoadingRequests[0];
+
+			if (request->isStarted)
+				request->readingJob.Wait();
+
+			if (request->cache->referencesCount <= 0)
+				CancelAsyncLoading(request);
+			else
+				CompleteAsyncLoadingNow(request->cache->asset);
+		}
+	}
+
 	Assets::AssetCache::~AssetCache()
 	{
 		delete asset;
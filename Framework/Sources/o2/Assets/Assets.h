@@ -2,12 +2,12 @@
 
 #include "o2/Assets/Asset.h"
 #include "o2/Assets/AssetInfo.h"
-#include "o2/Assets/AssetRef.h"
 #include "o2/Assets/AssetsTree.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 
 // Assets system access macros
@@ -15,6 +15,7 @@
 
 namespace o2
 {
+	class AssetRef;
 	class AssetsBuilder;
 	class LogStream;
 
@@ -70,6 +71,20 @@ namespace o2
 		// Returns asset reference by id
 		AssetRef GetAssetRef(const UID& id);
 
+		// Requests asset loading by path on worker threads. Returns reference immediately, asset becomes loaded later
+		// on main thread, check it by AssetRef::IsLoaded(). Requests with higher priority are started first.
+		// Loading is canceled when all references to asset are released before loading is completed
+		AssetRef LoadAssetAsync(const String& path, int priority = 0);
+
+		// Requests asset loading by id on worker threads. Works as LoadAssetAsync by path
+		AssetRef LoadAssetAsync(const UID& id, int priority = 0);
+
+		// Returns count of not completed asynchronous loading requests
+		int GetAsyncLoadingRequestsCount() const;
+
+		// Starts asynchronous loading requests and completes read ones. Called by application each frame
+		void Update();
+
 		// Creates asset type _asset_type
 		template<typename _asset_type, typename ... _args>
 		AssetRef CreateAsset(_args ... args);
@@ -140,6 +155,20 @@ namespace o2
 			~AssetCache();
 		};
 
+		// -------------------------------------------------------------------------------------------------------
+		// Asynchronous asset loading request. Data is read by job on worker thread, then loading is completed on
+		// main thread in Update()
+		// -------------------------------------------------------------------------------------------------------
+		struct AsyncLoadingRequest
+		{
+			AssetCache*  cache = nullptr;    // Loading asset cache
+			String       path;               // Built asset data path
+			int          priority = 0;       // Loading priority, requests with higher priority are started first
+			DataDocument data;               // Data read on worker thread
+			JobCounter   readingJob;         // Reading job counter, done when data is read
+			bool         isStarted = false;  // Is reading job started
+		};
+
 	protected:
 		AssetsTree*         mMainAssetsTree; // Main assets tree
 		Vector<AssetsTree*> mAssetsTrees;    // Assets trees
@@ -153,6 +182,8 @@ namespace o2
 		Map<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
 		Map<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
 
+		Vector<AsyncLoadingRequest*> mAsyncLoadingRequests; // Not completed asynchronous loading requests
+
 	protected:
 		// Loads asset infos
 		void LoadAssetsTree();
@@ -178,6 +209,31 @@ namespace o2
 		// Removes asset from cache by UID and path
 		void RemoveAssetCache(Asset* asset);
 
+		// Creates asset and asynchronous loading request for it
+		AssetCache* AddAsyncLoadingRequest(const AssetInfo& info, int priority);
+
+		// Returns asynchronous loading request of asset, or nullptr
+		AsyncLoadingRequest* FindAsyncLoadingRequest(Asset* asset) const;
+
+		// Starts reading jobs for requests with highest priorities, while free workers are available
+		void StartAsyncLoadingJobs();
+
+		// Starts reading job for request
+		void StartAsyncLoadingJob(AsyncLoadingRequest* request);
+
+		// Reads not started request data on current thread or waits reading job, then completes loading. Used when
+		// loading asset is required synchronously
+		void CompleteAsyncLoadingNow(Asset* asset);
+
+		// Completes loading with read data and removes request
+		void CompleteAsyncLoading(AsyncLoadingRequest* request);
+
+		// Removes request and asset, used when all references to asset are released before loading is completed
+		void CancelAsyncLoading(AsyncLoadingRequest* request);
+
+		// Waits all reading jobs and completes all requests, requests without references are canceled
+		void CompleteAllAsyncLoading();
+
 		// Removes asset by info
 		bool RemoveAsset(const AssetInfo& info, bool rebuildAssets = true);
 
@@ -194,7 +250,12 @@ namespace o2
 		friend class AssetRef;
 		friend class FolderAsset;
 	};
+}
+
+#include "o2/Assets/AssetRef.h"
 
+namespace o2
+{
 	template<typename _asset_type, typename ... _args>
 	AssetRef Assets::CreateAsset(_args ... args)
 	{
@@ -11,6 +11,7 @@
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 
 namespace o2
 {
@@ -58,12 +59,14 @@ namespace o2
 		builtAssetsTreeDoc.LoadFromFile(mBuiltAssetsTreePath);
 		mBuiltAssetsTree->Deserialize(builtAssetsTreeDoc);
 
+		CalculateContentHashes();
+
 		ProcessRemovedAssets();
 		ProcessNewAssets();
 		ProcessModifiedAssets();
 		ConvertersPostProcess();
 
-		if (!mModifiedAssets.IsEmpty())
+		if (!mModifiedAssets.IsEmpty() || mBuiltAssetsTreeChanged)
 		{
 			mBuiltAssetsTree->assetsPath = mSourceAssetsPath;
 			mBuiltAssetsTree->builtAssetsPath = mBuiltAssetsPath;
@@ -208,12 +211,50 @@ namespace o2
 		}
 	}
 
+	void AssetsBuilder::CalculateContentHashes()
+	{
+		const Type* folderType = &TypeOf(FolderAsset);
+
+		Vector<AssetInfo*> hashingAssets;
+		for (auto sourceAssetInfo : mSourceAssetsTree.allAssets)
+		{
+			if (sourceAssetInfo->meta->GetAssetType() == folderType)
+				continue;
+
+			AssetInfo* builtAssetInfo = nullptr;
+			mBuiltAssetsTree->allAssetsByUID.TryGetValue(sourceAssetInfo->meta->ID(), builtAssetInfo);
+
+			// Built trees saved before content hashes have zero hashes, such files are hashed anyway
+			if (builtAssetInfo && builtAssetInfo->contentHash != 0 && builtAssetInfo->editTime == sourceAssetInfo->editTime)
+				sourceAssetInfo->contentHash = builtAssetInfo->contentHash;
+			else
+				hashingAssets.Add(sourceAssetInfo);
+		}
+
+		ProcessParallel(hashingAssets.Count(), [&](int idx)
+		{
+			hashingAssets[idx]->contentHash = o2FileSystem.GetFileHash(mSourceAssetsPath + hashingAssets[idx]->path);
+		});
+	}
+
+	bool AssetsBuilder::IsAssetModified(const AssetInfo* sourceAssetInfo, const AssetInfo* builtAssetInfo) const
+	{
+		if (!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+			return true;
+
+		return sourceAssetInfo->editTime != builtAssetInfo->editTime &&
+			sourceAssetInfo->contentHash != builtAssetInfo->contentHash;
+	}
+
 	void AssetsBuilder::ProcessModifiedAssets()
 	{
 		const Type* folderType = &TypeOf(FolderAsset);
 
 		mSourceAssetsTree.SortAssets();
 
+		// Files are converted in parallel after all folders are processed
+		Vector<AssetInfo*> convertingAssets;
+
 		// in first pass processing folders, in second - files
 		for (int pass = 0; pass < 2; pass++)
 		{
@@ -231,24 +272,34 @@ namespace o2
 
 					if (sourceAssetInfo->path == builtAssetInfo->path)
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (IsAssetModified(sourceAssetInfo, builtAssetInfo))
 						{
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							if (isFolder)
+								GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							else
+								convertingAssets.Add(sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
 							mLog->Out("Modified asset: " + sourceAssetInfo->path);
 						}
+						else if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
+								 sourceAssetInfo->contentHash != builtAssetInfo->contentHash)
+						{
+							// Touched or checked out file with same content, built asset is actual
+							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
+							mBuiltAssetsTreeChanged = true;
+						}
 					}
 					else
 					{
-						if (sourceAssetInfo->editTime != builtAssetInfo->editTime ||
-							!sourceAssetInfo->meta->IsEqual(builtAssetInfo->meta))
+						if (IsAssetModified(sourceAssetInfo, builtAssetInfo))
 						{
 							GetAssetConverter(builtAssetInfo->meta->GetAssetType())->RemoveAsset(*builtAssetInfo);
 
@@ -258,11 +309,15 @@ namespace o2
 
 							builtAssetInfo->path = sourceAssetInfo->path;
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
-							GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							if (isFolder)
+								GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+							else
+								convertingAssets.Add(sourceAssetInfo);
 
 							mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 							mBuiltAssetsTree->AddAsset(builtAssetInfo);
@@ -276,6 +331,7 @@ namespace o2
 
 							builtAssetInfo->path = sourceAssetInfo->path;
 							builtAssetInfo->editTime = sourceAssetInfo->editTime;
+							builtAssetInfo->contentHash = sourceAssetInfo->contentHash;
 
 							delete builtAssetInfo->meta;
 							builtAssetInfo->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
@@ -287,6 +343,8 @@ namespace o2
 				}
 			}
 		}
+
+		ConvertAssets(convertingAssets);
 	}
 
 	void AssetsBuilder::ProcessNewAssets()
@@ -295,6 +353,9 @@ namespace o2
 
 		mSourceAssetsTree.SortAssets();
 
+		// Files are converted in parallel after all folders are processed
+		Vector<AssetInfo*> convertingAssets;
+
 		// in first pass skipping files (only folders), in second - folders
 		for (int pass = 0; pass < 2; pass++)
 		{
@@ -314,7 +375,10 @@ namespace o2
 				if (!isNew)
 					continue;
 
-				GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+				if (isFolder)
+					GetAssetConverter(sourceAssetInfo->meta->GetAssetType())->ConvertAsset(*sourceAssetInfo);
+				else
+					convertingAssets.Add(sourceAssetInfo);
 
 				mModifiedAssets.Add(sourceAssetInfo->meta->ID());
 
@@ -323,11 +387,14 @@ namespace o2
 				AssetInfo* newBuiltAsset = mnew AssetInfo();
 				newBuiltAsset->path = sourceAssetInfo->path;
 				newBuiltAsset->editTime = sourceAssetInfo->editTime;
+				newBuiltAsset->contentHash = sourceAssetInfo->contentHash;
 				newBuiltAsset->meta = sourceAssetInfo->meta->CloneAs<AssetMeta>();
 
 				mBuiltAssetsTree->AddAsset(newBuiltAsset);
 			}
 		}
+
+		ConvertAssets(convertingAssets);
 	}
 
 	void AssetsBuilder::ConvertersPostProcess()
@@ -354,15 +421,43 @@ namespace o2
 
 	IAssetConverter* AssetsBuilder::GetAssetConverter(const Type* assetType)
 	{
-		if (mAssetConverters.ContainsKey(assetType))
-			return mAssetConverters[assetType];
+		// Called from converting jobs, so map must not be changed here
+		auto fnd = mAssetConverters.find(assetType);
+		if (fnd != mAssetConverters.end())
+			return fnd->second;
 
 		return &mStdAssetConverter;
 	}
 
+	void AssetsBuilder::ConvertAssets(const Vector<AssetInfo*>& assets)
+	{
+		ProcessParallel(assets.Count(), [&](int idx)
+		{
+			GetAssetConverter(assets[idx]->meta->GetAssetType())->ConvertAsset(*assets[idx]);
+		});
+	}
+
+	void AssetsBuilder::ProcessParallel(int count, const Function<void(int)>& function)
+	{
+		if (!JobSystem::IsSingletonInitialzed())
+		{
+			for (int i = 0; i < count; i++)
+				function(i);
+
+			return;
+		}
+
+		o2Jobs.ParallelFor(count, [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+				function(i);
+		});
+	}
+
 	void AssetsBuilder::Reset()
 	{
 		mModifiedAssets.Clear();
+		mBuiltAssetsTreeChanged = false;
 		mSourceAssetsTree.Clear();
 		mBuiltAssetsTree->Clear();
 
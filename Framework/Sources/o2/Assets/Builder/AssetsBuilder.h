@@ -43,7 +43,8 @@ namespace o2
 		String      mBuiltAssetsTreePath; // Built assets tree data path
 		AssetsTree* mBuiltAssetsTree;     // Built assets tree
 
-		Vector<UID> mModifiedAssets; // Modified assets infos
+		Vector<UID> mModifiedAssets;                 // Modified assets infos
+		bool        mBuiltAssetsTreeChanged = false; // Is built assets tree changed without modified assets, when only edit times are actualized
 
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
@@ -61,6 +62,13 @@ namespace o2
 		// Searching and removing assets
 		void ProcessRemovedAssets();
 
+		// Calculates source files contents hashes. Files with same edit time as built are not read, hash is taken from built tree
+		void CalculateContentHashes();
+
+		// Returns true when source asset is modified relative to built: meta is changed or file content is changed.
+		// Edit time is checked first, so unchanged files aren't compared by content
+		bool IsAssetModified(const AssetInfo* sourceAssetInfo, const AssetInfo* builtAssetInfo) const;
+
 		// Searching modified and moved assets
 		void ProcessModifiedAssets();
 
@@ -79,6 +87,13 @@ namespace o2
 		// Returns assets converter by asset type
 		IAssetConverter* GetAssetConverter(const Type* assetType);
 
+		// Converts assets in parallel. Assets must be independent: files, when their folders are already converted
+		void ConvertAssets(const Vector<AssetInfo*>& assets);
+
+		// Calls function for each item index in parallel on job system workers, or serially when job system isn't
+		// initialized
+		void ProcessParallel(int count, const Function<void(int)>& function);
+
 		// Resets builder
 		void Reset();
 
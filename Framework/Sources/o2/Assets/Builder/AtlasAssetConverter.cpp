@@ -7,6 +7,7 @@
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Tools/Hash.h"
 
 namespace o2
 {
@@ -100,19 +101,63 @@ namespace o2
 		Vector<UID> res;
 		const Type* atlasAssetType = &TypeOf(AtlasAsset);
 
+		Vector<AtlasRebuildDef> rebuildingAtlases;
 		for (auto info : mAssetsBuilder->mBuiltAssetsTree->allAssets)
 		{
 			if (info->meta->GetAssetType() == atlasAssetType)
 			{
-				if (CheckAtlasRebuilding(info))
-					res.Add(info->meta->ID());
+				AtlasRebuildDef atlas;
+				atlas.atlasInfo = info;
+
+				if (CheckAtlasRebuilding(info, atlas.images))
+				{
+					// Atlases restored from build cache don't need images bitmaps
+					atlas.cacheKey = GetBuildCacheKey(atlas);
+					atlas.isCached = LoadFromBuildCache(atlas);
+
+					if (!atlas.isCached)
+						InitializePackImages(atlas);
+
+					rebuildingAtlases.Add(atlas);
+				}
 			}
 		}
 
+		if (rebuildingAtlases.IsEmpty())
+			return res;
+
+		LoadPackImagesBitmaps(rebuildingAtlases);
+
+		mAssetsBuilder->ProcessParallel(rebuildingAtlases.Count(), [&](int idx)
+		{
+			AtlasRebuildDef& atlas = rebuildingAtlases[idx];
+			if (atlas.isCached)
+				atlas.isPacked = RestoreFromBuildCache(atlas);
+			else
+				atlas.isPacked = RebuildAtlas(atlas);
+		});
+
+		for (auto& atlas : rebuildingAtlases)
+		{
+			if (atlas.isPacked && atlas.isCached)
+				mAssetsBuilder->mLog->Out("Atlas " + atlas.atlasInfo->path + " restored from build cache");
+			else if (atlas.isPacked)
+				mAssetsBuilder->mLog->Out("Atlas " + atlas.atlasInfo->path + " successfully packed");
+			else if (atlas.isCached)
+				mAssetsBuilder->mLog->Error("Atlas " + atlas.atlasInfo->path + " restoring from build cache failed");
+			else
+				mAssetsBuilder->mLog->Error("Atlas " + atlas.atlasInfo->path + " packing failed");
+
+			for (auto& imgDef : atlas.packImages)
+				delete imgDef.bitmap;
+
+			res.Add(atlas.atlasInfo->meta->ID());
+		}
+
 		return res;
 	}
 
-	bool AtlasAssetConverter::CheckAtlasRebuilding(AssetInfo* atlasInfo)
+	bool AtlasAssetConverter::CheckAtlasRebuilding(AssetInfo* atlasInfo, Vector<Image>& currentImages)
 	{
 		DataDocument atlasData;
 		atlasData.LoadFromFile(mAssetsBuilder->mBuiltAssetsPath + atlasInfo->path);
@@ -120,7 +165,6 @@ namespace o2
 		Vector<Image> lastImages;
 		lastImages = atlasData["mImages"];
 
-		Vector<Image> currentImages;
 		const Type* imageType = &TypeOf(ImageAsset);
 		const UID& atlasId = atlasInfo->meta->ID();
 		for (auto assetInfo : mAssetsBuilder->mBuiltAssetsTree->allAssets)
@@ -129,17 +173,11 @@ namespace o2
 			{
 				ImageAsset::Meta* imageMeta = (ImageAsset::Meta*)assetInfo->meta;
 				if (imageMeta->atlasId == atlasId)
-					currentImages.Add(Image(imageMeta->ID(), assetInfo->editTime));
+					currentImages.Add(Image(imageMeta->ID(), assetInfo->contentHash));
 			}
 		}
 
-		if (IsAtlasNeedRebuild(currentImages, lastImages))
-		{
-			RebuildAtlas(atlasInfo, currentImages);
-			return true;
-		}
-
-		return false;
+		return IsAtlasNeedRebuild(currentImages, lastImages);
 	}
 
 	bool AtlasAssetConverter::IsAtlasNeedRebuild(Vector<Image>& currentImages, Vector<Image>& lastImages)
@@ -154,7 +192,7 @@ namespace o2
 			{
 				if (lastImg.id == curImg.id)
 				{
-					if (lastImg.time != curImg.time)
+					if (lastImg.hash != curImg.hash)
 					{
 						return true;
 					}
@@ -179,18 +217,10 @@ namespace o2
 		return false;
 	}
 
-	void AtlasAssetConverter::RebuildAtlas(AssetInfo* atlasInfo, Vector<Image>& images)
+	void AtlasAssetConverter::InitializePackImages(AtlasRebuildDef& atlas)
 	{
-		auto meta = (AtlasAsset::Meta*)atlasInfo->meta;
-
-		RectsPacker packer(meta->windows.maxSize);
-		float imagesBorder = (float)meta->border;
-
-		// Initialize pack images
-		Vector<ImagePackDef> packImages;
-		for (auto img : images)
+		for (auto img : atlas.images)
 		{
-			// Find image info
 			AssetInfo* imgInfo = nullptr;
 			mAssetsBuilder->mBuiltAssetsTree->allAssetsByUID.TryGetValue(img.id, imgInfo);
 			if (!imgInfo)
@@ -199,36 +229,61 @@ namespace o2
 				continue;
 			}
 
-			String assetFullPath = mAssetsBuilder->GetSourceAssetsPath() + imgInfo->path;
+			ImagePackDef imagePackDef;
+			imagePackDef.assetInfo = imgInfo;
+			atlas.packImages.Add(imagePackDef);
+		}
+	}
+
+	void AtlasAssetConverter::LoadPackImagesBitmaps(Vector<AtlasRebuildDef>& atlases)
+	{
+		// Bitmaps decoding takes most of rebuilding time, images of all atlases are loaded together
+		Vector<ImagePackDef*> loadingImages;
+		for (auto& atlas : atlases)
+		{
+			for (auto& imgDef : atlas.packImages)
+				loadingImages.Add(&imgDef);
+		}
+
+		mAssetsBuilder->ProcessParallel(loadingImages.Count(), [&](int idx)
+		{
+			ImagePackDef* imgDef = loadingImages[idx];
 
-			// Load bitmap
 			Bitmap* bitmap = mnew Bitmap();
-			if (!bitmap->Load(assetFullPath))
-			{
-				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgInfo->path);
+			if (bitmap->Load(mAssetsBuilder->GetSourceAssetsPath() + imgDef->assetInfo->path))
+				imgDef->bitmap = bitmap;
+			else
 				delete bitmap;
-				continue;
-			}
-
-			// Create packing rect
-			RectsPacker::Rect* packRect = packer.AddRect(bitmap->GetSize() +
-														 Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
+		});
 
-			ImagePackDef imagePackDef;
-			imagePackDef.assetInfo = imgInfo;
-			imagePackDef.bitmap = bitmap;
-			imagePackDef.packRect = packRect;
+		for (auto& atlas : atlases)
+		{
+			atlas.packImages.RemoveAll([&](const ImagePackDef& imgDef)
+			{
+				if (imgDef.bitmap)
+					return false;
 
-			packImages.Add(imagePackDef);
+				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgDef.assetInfo->path);
+				return true;
+			});
 		}
+	}
+
+	bool AtlasAssetConverter::RebuildAtlas(AtlasRebuildDef& atlas)
+	{
+		AssetInfo* atlasInfo = atlas.atlasInfo;
+		auto meta = (AtlasAsset::Meta*)atlasInfo->meta;
+
+		RectsPacker packer(meta->windows.maxSize);
+		float imagesBorder = (float)meta->border;
+
+		// Create packing rects
+		for (auto& imgDef : atlas.packImages)
+			imgDef.packRect = packer.AddRect(imgDef.bitmap->GetSize() + Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
 
 		// Try to pack
 		if (!packer.Pack())
-		{
-			mAssetsBuilder->mLog->Error("Atlas " + atlasInfo->path + " packing failed");
-			return;
-		}
-		else mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + " successfully packed");
+			return false;
 
 		// Initialize bitmaps and pages
 		int pagesCount = packer.GetPagesCount();
@@ -248,7 +303,7 @@ namespace o2
 		}
 
 		// Save image assets data and fill pages
-		for (auto imgDef : packImages)
+		for (auto& imgDef : atlas.packImages)
 		{
 			imgDef.packRect->rect.left += imagesBorder;
 			imgDef.packRect->rect.right -= imagesBorder;
@@ -261,7 +316,7 @@ namespace o2
 			resAtlasPages[imgDef.packRect->page].mImagesRects.Add(imgDef.assetInfo->meta->ID(),
 																  imgDef.packRect->rect);
 
-			SaveImageAsset(imgDef);
+			SaveImageAsset(*imgDef.assetInfo, imgDef.packRect->page, (RectI)imgDef.packRect->rect);
 		}
 
 		// Save pages bitmaps
@@ -273,38 +328,138 @@ namespace o2
 			delete resAtlasBitmaps[i];
 		}
 
-		// Save atlas data
+		SaveAtlasData(atlas, resAtlasPages);
+
+		// Atlas without some images isn't cached, they will be packed again when become available
+		if (atlas.packImages.Count() == atlas.images.Count())
+			SaveToBuildCache(atlas, resAtlasPages);
+
+		return true;
+	}
+
+	void AtlasAssetConverter::SaveAtlasData(const AtlasRebuildDef& atlas, const Vector<AtlasAsset::Page>& pages)
+	{
+		AssetInfo* atlasInfo = atlas.atlasInfo;
 		String atlasFullPath = mAssetsBuilder->GetSourceAssetsPath() + atlasInfo->path;
 		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path;
 
 		DataDocument atlasData;
 		atlasData.LoadFromFile(atlasFullPath);
-		atlasData["mPages"] = resAtlasPages;
-		atlasData["mImages"] = images;
+		atlasData["mPages"] = pages;
+		atlasData["mImages"] = atlas.images;
 
 		atlasData.SaveToFile(atlasFullPath);
 		atlasData.SaveToFile(atlasFullBuiltPath);
 
 		o2FileSystem.SetFileEditDate(atlasFullPath, atlasInfo->editTime);
 		o2FileSystem.SetFileEditDate(atlasFullBuiltPath, atlasInfo->editTime);
+
+		// Source atlas file is rewritten with same edit time, so its hash must be actual in built tree
+		atlasInfo->contentHash = o2FileSystem.GetFileHash(atlasFullPath);
 	}
 
-	void AtlasAssetConverter::SaveImageAsset(ImagePackDef& imgDef)
+	void AtlasAssetConverter::SaveImageAsset(const AssetInfo& imageInfo, UInt page, const RectI& rect)
 	{
 		DataDocument imgData;
-		imgData["mAtlasPage"] = imgDef.packRect->page;
-		imgData["mAtlasRect"] = (RectI)(imgDef.packRect->rect);
-		String imageFullPath = mAssetsBuilder->GetBuiltAssetsPath() + imgDef.assetInfo->path;
+		imgData["mAtlasPage"] = page;
+		imgData["mAtlasRect"] = rect;
+		String imageFullPath = mAssetsBuilder->GetBuiltAssetsPath() + imageInfo.path;
 		imgData.SaveToFile(imageFullPath);
-		o2FileSystem.SetFileEditDate(imageFullPath, imgDef.assetInfo->editTime);
+		o2FileSystem.SetFileEditDate(imageFullPath, imageInfo.editTime);
+
+		DataDocument metaData;
+		metaData = imageInfo.meta;
+		metaData.SaveToFile(mAssetsBuilder->GetSourceAssetsPath() + imageInfo.path + ".meta");
+	}
+
+	String AtlasAssetConverter::GetBuildCacheKey(const AtlasRebuildDef& atlas) const
+	{
+		UInt64 version = mBuildCacheVersion;
+		UInt64 hash = GetFNV1aHash(&version, sizeof(version));
 
 		DataDocument metaData;
-		metaData = imgDef.assetInfo->meta;
-		metaData.SaveToFile(mAssetsBuilder->GetSourceAssetsPath() + imgDef.assetInfo->path + ".meta");
+		metaData = atlas.atlasInfo->meta;
+		String metaString = metaData.SaveAsString();
+		hash = GetFNV1aHash(metaString.Data(), metaString.Length(), hash);
+
+		Vector<Image> images = atlas.images;
+		images.Sort([](const Image& a, const Image& b) { return (String)a.id < (String)b.id; });
+
+		for (auto& image : images)
+		{
+			String id = image.id;
+			hash = GetFNV1aHash(id.Data(), id.Length(), hash);
+			hash = GetFNV1aHash(&image.hash, sizeof(image.hash), hash);
+		}
+
+		return (String)hash;
+	}
+
+	String AtlasAssetConverter::GetBuildCachePath(const String& cacheKey) const
+	{
+		return String(GetAssetsBuildCachePath()) + "Atlases/" + cacheKey + "/";
+	}
+
+	bool AtlasAssetConverter::LoadFromBuildCache(AtlasRebuildDef& atlas)
+	{
+		String cachePath = GetBuildCachePath(atlas.cacheKey);
+
+		DataDocument cacheData;
+		if (!cacheData.LoadFromFile(cachePath + "Atlas.json"))
+			return false;
+
+		atlas.cachedPages = cacheData["mPages"];
+
+		for (auto& page : atlas.cachedPages)
+		{
+			if (!o2FileSystem.IsFileExist(cachePath + (String)page.mId + ".png"))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool AtlasAssetConverter::RestoreFromBuildCache(AtlasRebuildDef& atlas)
+	{
+		String cachePath = GetBuildCachePath(atlas.cacheKey);
+		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlas.atlasInfo->path;
+
+		for (auto& page : atlas.cachedPages)
+		{
+			if (!o2FileSystem.FileCopy(cachePath + (String)page.mId + ".png", atlasFullBuiltPath + (String)page.mId + ".png"))
+				return false;
+
+			for (auto& imageRect : page.mImagesRects)
+			{
+				AssetInfo* imageInfo = nullptr;
+				if (mAssetsBuilder->mBuiltAssetsTree->allAssetsByUID.TryGetValue(imageRect.first, imageInfo))
+					SaveImageAsset(*imageInfo, page.mId, imageRect.second);
+			}
+		}
+
+		SaveAtlasData(atlas, atlas.cachedPages);
+
+		return true;
+	}
+
+	void AtlasAssetConverter::SaveToBuildCache(const AtlasRebuildDef& atlas, const Vector<AtlasAsset::Page>& pages)
+	{
+		String cachePath = GetBuildCachePath(atlas.cacheKey);
+		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlas.atlasInfo->path;
+
+		o2FileSystem.FolderCreate(cachePath);
+
+		for (auto& page : pages)
+			o2FileSystem.FileCopy(atlasFullBuiltPath + (String)page.mId + ".png", cachePath + (String)page.mId + ".png");
+
+		// Pages data is saved last, entry without it isn't used
+		DataDocument cacheData;
+		cacheData["mPages"] = pages;
+		cacheData.SaveToFile(cachePath + "Atlas.json");
 	}
 
-	AtlasAssetConverter::Image::Image(const UID& id, const TimeStamp& time):
-		id(id), time(time)
+	AtlasAssetConverter::Image::Image(const UID& id, UInt64 hash):
+		id(id), hash(hash)
 	{}
 
 	bool AtlasAssetConverter::Image::operator==(const Image& other) const
@@ -2,6 +2,7 @@
 
 #include "IAssetConverter.h"
 #include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Assets/Types/AtlasAsset.h"
 #include "o2/Utils/Tools/RectPacker.h"
 
 namespace o2
@@ -40,15 +41,15 @@ namespace o2
 		// ----------------
 		struct Image: public ISerializable
 		{
-			UID       id;   // Image asset id @SERIALIZABLE
-			TimeStamp time; // Image asset edited date @SERIALIZABLE
+			UID    id;       // Image asset id @SERIALIZABLE
+			UInt64 hash = 0; // Image asset content hash @SERIALIZABLE
 
 		public:
 			// Default constructor
 			Image() {}
 
 			// Constructor
-			Image(const UID& id, const TimeStamp& time);
+			Image(const UID& id, UInt64 hash);
 
 			// Check equal operator
 			bool operator==(const Image& other) const;
@@ -69,6 +70,25 @@ namespace o2
 			bool operator==(const ImagePackDef& other) const;
 		};
 
+		// ---------------------------------------------------------------------------------
+		// Atlas rebuilding definition. Atlases have own images, pages and files, so they are
+		// packed and saved independently. Atlas found in build cache isn't packed, its pages
+		// are restored from cache
+		// ---------------------------------------------------------------------------------
+		struct AtlasRebuildDef
+		{
+			AssetInfo*               atlasInfo = nullptr; // Atlas asset information
+			Vector<Image>            images;              // Atlas images
+			Vector<ImagePackDef>     packImages;          // Images packing definitions
+			bool                     isPacked = false;    // Is atlas packed successfully
+			String                   cacheKey;            // Build cache key: hash of converter version, atlas meta and images hashes
+			bool                     isCached = false;    // Is atlas found in build cache
+			Vector<AtlasAsset::Page> cachedPages;         // Pages loaded from build cache
+		};
+
+	protected:
+		static constexpr UInt64 mBuildCacheVersion = 1; // Build cache version, must be increased when packing result is changed
+
 	protected:
 		// Checks images for attaching to base atlas
 		void CheckBasicAtlas();
@@ -76,17 +96,42 @@ namespace o2
 		// Checks atlases for rebuilding
 		Vector<UID> CheckRebuildingAtlases();
 
-		// Checks atlas for rebuilding
-		bool CheckAtlasRebuilding(AssetInfo* atlasInfo);
+		// Checks atlas for rebuilding, collects atlas images into currentImages
+		bool CheckAtlasRebuilding(AssetInfo* atlasInfo, Vector<Image>& currentImages);
 
 		// Returns true if atlas needs to rebuild
 		bool IsAtlasNeedRebuild(Vector<Image>& currentImages, Vector<Image>& lastImages);
 
-		// Rebuilds atlas
-		void RebuildAtlas(AssetInfo* atlasInfo, Vector<Image>& images);
+		// Searches images infos and initializes packing definitions without bitmaps
+		void InitializePackImages(AtlasRebuildDef& atlas);
+
+		// Loads images bitmaps of all rebuilding atlases in parallel, removes images failed to load
+		void LoadPackImagesBitmaps(Vector<AtlasRebuildDef>& atlases);
+
+		// Packs atlas images, saves pages, images and atlas data. Returns false when packing failed.
+		// Can be called from worker thread for different atlases simultaneously
+		bool RebuildAtlas(AtlasRebuildDef& atlas);
+
+		// Saves atlas data with pages and images into source and built atlas files, actualizes atlas content hash
+		void SaveAtlasData(const AtlasRebuildDef& atlas, const Vector<AtlasAsset::Page>& pages);
 
 		// Saves image asset data
-		void SaveImageAsset(ImagePackDef& imgDef);
+		void SaveImageAsset(const AssetInfo& imageInfo, UInt page, const RectI& rect);
+
+		// Returns build cache key for atlas. Images are sorted by id, so key doesn't depend on images order
+		String GetBuildCacheKey(const AtlasRebuildDef& atlas) const;
+
+		// Returns build cache entry path by key
+		String GetBuildCachePath(const String& cacheKey) const;
+
+		// Loads atlas pages from build cache entry. Returns false when entry isn't exist or incomplete
+		bool LoadFromBuildCache(AtlasRebuildDef& atlas);
+
+		// Copies cached pages bitmaps, saves images and atlas data. Can be called from worker thread
+		bool RestoreFromBuildCache(AtlasRebuildDef& atlas);
+
+		// Stores atlas pages bitmaps and data into build cache. Can be called from worker thread
+		void SaveToBuildCache(const AtlasRebuildDef& atlas, const Vector<AtlasAsset::Page>& pages);
 	};
 }
 
@@ -110,10 +155,18 @@ CLASS_METHODS_META(o2::AtlasAssetConverter)
 	PUBLIC_FUNCTION(void, Reset);
 	PROTECTED_FUNCTION(void, CheckBasicAtlas);
 	PROTECTED_FUNCTION(Vector<UID>, CheckRebuildingAtlases);
-	PROTECTED_FUNCTION(bool, CheckAtlasRebuilding, AssetInfo*);
+	PROTECTED_FUNCTION(bool, CheckAtlasRebuilding, AssetInfo*, Vector<Image>&);
 	PROTECTED_FUNCTION(bool, IsAtlasNeedRebuild, Vector<Image>&, Vector<Image>&);
-	PROTECTED_FUNCTION(void, RebuildAtlas, AssetInfo*, Vector<Image>&);
-	PROTECTED_FUNCTION(void, SaveImageAsset, ImagePackDef&);
+	PROTECTED_FUNCTION(void, InitializePackImages, AtlasRebuildDef&);
+	PROTECTED_FUNCTION(void, LoadPackImagesBitmaps, Vector<AtlasRebuildDef>&);
+	PROTECTED_FUNCTION(bool, RebuildAtlas, AtlasRebuildDef&);
+	PROTECTED_FUNCTION(void, SaveAtlasData, const AtlasRebuildDef&, const Vector<AtlasAsset::Page>&);
+	PROTECTED_FUNCTION(void, SaveImageAsset, const AssetInfo&, UInt, const RectI&);
+	PROTECTED_FUNCTION(String, GetBuildCacheKey, const AtlasRebuildDef&);
+	PROTECTED_FUNCTION(String, GetBuildCachePath, const String&);
+	PROTECTED_FUNCTION(bool, LoadFromBuildCache, AtlasRebuildDef&);
+	PROTECTED_FUNCTION(bool, RestoreFromBuildCache, AtlasRebuildDef&);
+	PROTECTED_FUNCTION(void, SaveToBuildCache, const AtlasRebuildDef&, const Vector<AtlasAsset::Page>&);
 }
 END_META;
 
@@ -125,7 +178,7 @@ END_META;
 CLASS_FIELDS_META(o2::AtlasAssetConverter::Image)
 {
 	PUBLIC_FIELD(id).SERIALIZABLE_ATTRIBUTE();
-	PUBLIC_FIELD(time).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(hash).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
 }
 END_META;
 CLASS_METHODS_META(o2::AtlasAssetConverter::Image)
@@ -23,7 +23,8 @@ namespace o2
 		// Returns vector of processing assets types
 		virtual Vector<const Type*> GetProcessingAssetsTypes() const;
 
-		// Converts asset by path
+		// Converts asset by path. Files are converted on job system workers, converter must support converting
+		// of different assets simultaneously. Folders are converted on calling thread before files
 		virtual void ConvertAsset(const AssetInfo& node);
 
 		// Removes asset by path
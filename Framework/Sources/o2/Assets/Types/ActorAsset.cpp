@@ -63,8 +63,13 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::ActorAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::ActorAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::ActorAsset>);
 
 DECLARE_CLASS(o2::ActorAsset);
@@ -3,6 +3,8 @@
 
 #include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Assets/Assets.h"
+#include "o2/Render/Render.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
 
 namespace o2
 {
@@ -57,12 +59,72 @@ namespace o2
 			page.mOwner = this;
 	}
 
+	AtlasAsset::~AtlasAsset()
+	{
+		for (auto& kv : mLoadedPagesBitmaps)
+			delete kv.second;
+	}
+
 	void AtlasAsset::OnDeserialized(const DataValue& node)
 	{
 		for (auto& page : mPages)
 			page.mOwner = this;
 	}
 
+	void AtlasAsset::PrepareDataReading()
+	{
+		// Render textures list isn't available on worker thread, so loaded pages textures are collected here
+		String pagesPath = (mInfo.tree ? mInfo.tree->builtAssetsPath : String()) + mInfo.path;
+
+		mCachedPagesTextures.Clear();
+		for (auto texture : o2Render.GetTextures())
+		{
+			if (texture->GetFileName().StartsWith(pagesPath))
+				mCachedPagesTextures.Add(texture->GetFileName());
+		}
+	}
+
+	void AtlasAsset::ReadDataAsync(const String& path, DataDocument& data)
+	{
+		Asset::ReadDataAsync(path, data);
+
+		// Pages images are the heaviest part of atlas, so they are decoded here and only uploaded on main thread
+		auto pagesData = data.FindMember("mPages");
+		if (!pagesData || !pagesData->IsArray())
+			return;
+
+		for (auto& pageData : *pagesData)
+		{
+			UInt pageId = pageData.GetMember("mId");
+			String fileName = GetPageTextureFileName(mInfo, pageId);
+			if (mCachedPagesTextures.Contains(fileName))
+				continue;
+
+			Bitmap* bitmap = mnew Bitmap();
+			if (bitmap->Load(fileName))
+				mLoadedPagesBitmaps[fileName] = bitmap;
+			else
+				delete bitmap;
+		}
+	}
+
+	void AtlasAsset::CompleteDataLoading(const String& path, DataDocument& data)
+	{
+		Asset::CompleteDataLoading(path, data);
+
+		for (auto& fileName : mCachedPagesTextures)
+			mPagesTextures.Add(TextureRef(fileName));
+
+		for (auto& kv : mLoadedPagesBitmaps)
+		{
+			mPagesTextures.Add(TextureRef(kv.first, kv.second));
+			delete kv.second;
+		}
+
+		mCachedPagesTextures.Clear();
+		mLoadedPagesBitmaps.Clear();
+	}
+
 	AtlasAsset& AtlasAsset::operator=(const AtlasAsset& other)
 	{
 		Asset::operator=(other);
@@ -130,7 +192,10 @@ namespace o2
 	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::AtlasAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::AtlasAsset>);
 
 DECLARE_CLASS(o2::AtlasAsset);
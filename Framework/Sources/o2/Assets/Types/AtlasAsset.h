@@ -29,6 +29,9 @@ namespace o2
 		// Copy-constructor
 		AtlasAsset(const AtlasAsset& asset);
 
+		// Destructor
+		~AtlasAsset();
+
 		// Check equals operator
 		AtlasAsset& operator=(const AtlasAsset& asset);
 
@@ -143,10 +146,23 @@ namespace o2
 		Vector<ImageAssetRef> mImages; // Loaded image infos @SERIALIZABLE
 		Vector<Page>          mPages;  // Pages @SERIALIZABLE
 
+		Vector<String>       mCachedPagesTextures; // File names of pages textures loaded before asynchronous reading, they aren't decoded again
+		Map<String, Bitmap*> mLoadedPagesBitmaps;  // Pages bitmaps by textures file names, decoded on worker thread when loading asynchronously
+		Vector<TextureRef>   mPagesTextures;       // Pages textures uploaded after asynchronous loading, kept while atlas is alive
+
 	protected:
 		// Completion deserialization callback
 		void OnDeserialized(const DataValue& node) override;
 
+		// Collects already loaded pages textures on main thread
+		void PrepareDataReading() override;
+
+		// Reads data and decodes pages bitmaps on worker thread
+		void ReadDataAsync(const String& path, DataDocument& data) override;
+
+		// Deserializes data and uploads decoded pages bitmaps into textures
+		void CompleteDataLoading(const String& path, DataDocument& data) override;
+
 		friend class Assets;
 		friend class ImageAsset;
 	};
@@ -166,6 +182,9 @@ CLASS_FIELDS_META(o2::AtlasAsset)
 	PUBLIC_FIELD(pages);
 	PROTECTED_FIELD(mImages).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mPages).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mCachedPagesTextures);
+	PROTECTED_FIELD(mLoadedPagesBitmaps);
+	PROTECTED_FIELD(mPagesTextures);
 }
 END_META;
 CLASS_METHODS_META(o2::AtlasAsset)
@@ -184,6 +203,9 @@ CLASS_METHODS_META(o2::AtlasAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
+	PROTECTED_FUNCTION(void, PrepareDataReading);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 }
 END_META;
 
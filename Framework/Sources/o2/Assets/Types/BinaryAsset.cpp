@@ -103,10 +103,23 @@ namespace o2
 		if (mDataSize > 0 && mData)
 			file.WriteData(mData, mDataSize);
 	}
+
+	void BinaryAsset::ReadDataAsync(const String& path, DataDocument& data)
+	{
+		LoadData(path);
+	}
+
+	void BinaryAsset::CompleteDataLoading(const String& path, DataDocument& data)
+	{}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::BinaryAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BinaryAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BinaryAsset>);
 
 DECLARE_CLASS(o2::BinaryAsset);
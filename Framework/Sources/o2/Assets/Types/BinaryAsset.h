@@ -55,6 +55,12 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
+		// Reads binary data on worker thread, it doesn't require main thread
+		void ReadDataAsync(const String& path, DataDocument& data) override;
+
+		// Does nothing, data is already read
+		void CompleteDataLoading(const String& path, DataDocument& data) override;
+
 		friend class Assets;
 	};
 
@@ -84,5 +90,7 @@ CLASS_METHODS_META(o2::BinaryAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 }
 END_META;
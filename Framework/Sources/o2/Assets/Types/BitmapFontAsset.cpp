@@ -39,8 +39,19 @@ namespace o2
 		if (!mFont)
 			mFont = mnew BitmapFont(path);
 	}
+
+	void BitmapFontAsset::ReadDataAsync(const String& path, DataDocument& data)
+	{}
+
+	void BitmapFontAsset::CompleteDataLoading(const String& path, DataDocument& data)
+	{
+		LoadData(path);
+	}
 }
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::BitmapFontAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::BitmapFontAsset>);
 
 DECLARE_CLASS(o2::BitmapFontAsset);
@@ -53,6 +53,12 @@ namespace o2
 		// Loads data
 		void LoadData(const String& path) override;
 
+		// Does nothing, font creates texture and is loaded on main thread
+		void ReadDataAsync(const String& path, DataDocument& data) override;
+
+		// Loads font on main thread
+		void CompleteDataLoading(const String& path, DataDocument& data) override;
+
 		friend class Assets;
 	};
 
@@ -76,6 +82,8 @@ CLASS_METHODS_META(o2::BitmapFontAsset)
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 }
 END_META;
 
@@ -35,10 +35,23 @@ namespace o2
 	{
 		data.SaveToFile(path);
 	}
+
+	void DataAsset::ReadDataAsync(const String& path, DataDocument& data)
+	{
+		LoadData(path);
+	}
+
+	void DataAsset::CompleteDataLoading(const String& path, DataDocument& data)
+	{}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::DataAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::DataAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::DataAsset>);
 
 DECLARE_CLASS(o2::DataAsset);
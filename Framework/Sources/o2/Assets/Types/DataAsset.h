@@ -44,6 +44,12 @@ namespace o2
 		// Saves data
 		void SaveData(const String& path) const override;
 
+		// Reads data on worker thread, it doesn't require main thread
+		void ReadDataAsync(const String& path, DataDocument& data) override;
+
+		// Does nothing, data is already read
+		void CompleteDataLoading(const String& path, DataDocument& data) override;
+
 		friend class Assets;
 	};
 
@@ -69,5 +75,7 @@ CLASS_METHODS_META(o2::DataAsset)
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 }
 END_META;
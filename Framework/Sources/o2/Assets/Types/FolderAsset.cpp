@@ -36,10 +36,21 @@ namespace o2
 		if (!o2FileSystem.IsFolderExist(path))
 			o2FileSystem.FolderCreate(path);
 	}
+
+	void FolderAsset::ReadDataAsync(const String& path, DataDocument& data)
+	{}
+
+	void FolderAsset::CompleteDataLoading(const String& path, DataDocument& data)
+	{}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::AssetWithDefaultMeta<o2::FolderAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::FolderAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::FolderAsset>);
 
 DECLARE_CLASS(o2::FolderAsset);
@@ -40,6 +40,12 @@ namespace o2
 		// Saves asset data
 		void SaveData(const String& path) const override;
 
+		// Does nothing, folder hasn't data
+		void ReadDataAsync(const String& path, DataDocument& data) override;
+
+		// Does nothing, folder hasn't data
+		void CompleteDataLoading(const String& path, DataDocument& data) override;
+
 		friend class Assets;
 	};
 
@@ -64,5 +70,7 @@ CLASS_METHODS_META(o2::FolderAsset)
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 }
 END_META;
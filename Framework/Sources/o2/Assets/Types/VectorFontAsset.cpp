@@ -122,9 +122,20 @@ namespace o2
 
 		dynamic_cast<VectorFont*>(mFont.mFont)->SetEffects(clonedEffects);
 	}
+
+	void VectorFontAsset::ReadDataAsync(const String& path, DataDocument& data)
+	{}
+
+	void VectorFontAsset::CompleteDataLoading(const String& path, DataDocument& data)
+	{
+		LoadData(path);
+	}
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::DefaultAssetMeta<o2::VectorFontAsset>);
+
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::VectorFontAsset>);
 
 DECLARE_CLASS(o2::VectorFontAsset);
@@ -91,6 +91,12 @@ namespace o2
 		// Saves asset data, using DataValue and serialization
 		void SaveData(const String& path) const override;
 
+		// Does nothing, font creates texture and is loaded on main thread
+		void ReadDataAsync(const String& path, DataDocument& data) override;
+
+		// Loads font on main thread
+		void CompleteDataLoading(const String& path, DataDocument& data) override;
+
 		// Updates font effects in 
 		void UpdateFontEffects();
 
@@ -128,6 +134,8 @@ CLASS_METHODS_META(o2::VectorFontAsset)
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PROTECTED_FUNCTION(void, LoadData, const String&);
 	PROTECTED_FUNCTION(void, SaveData, const String&);
+	PROTECTED_FUNCTION(void, ReadDataAsync, const String&, DataDocument&);
+	PROTECTED_FUNCTION(void, CompleteDataLoading, const String&, DataDocument&);
 	PROTECTED_FUNCTION(void, UpdateFontEffects);
 }
 END_META;
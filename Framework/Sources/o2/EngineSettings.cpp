@@ -5,6 +5,8 @@ o2::Platform GetEnginePlatform()
 {
 #ifdef PLATFORM_WINDOWS
 	return o2::Platform::Windows;
+#elif defined PLATFORM_LINUX
+	return o2::Platform::Linux;
 #elif defined PLATFORM_ANDROID
 	return o2::Platform::Android;
 #endif
@@ -49,7 +51,7 @@ bool IsReleaseBuild()
 
 bool IsAssetsPrebuildEnabled()
 {
-#ifdef PLATFORM_WINDOWS
+#if defined PLATFORM_WINDOWS || defined PLATFORM_LINUX
 	return true;
 #else
 	return false;
@@ -65,6 +67,8 @@ const char* GetBuiltAssetsPath()
 {
 #if defined PLATFORM_WINDOWS
 	return "BuiltAssets/Windows/Data/";
+#elif defined PLATFORM_LINUX
+	return "BuiltAssets/Linux/Data/";
 #elif defined PLATFORM_ANDROID
 	return "AndroidAssets/BuiltAssets/";
 #endif
@@ -79,11 +83,18 @@ const char* GetBuiltAssetsTreePath()
 {
 #if defined PLATFORM_WINDOWS
 	return "BuiltAssets/Windows/Data.json";
+#elif defined PLATFORM_LINUX
+	return "BuiltAssets/Linux/Data.json";
 #elif defined PLATFORM_ANDROID
 	return "AndroidAssets/AssetsTree.json";
 #endif
 }
 
+const char* GetAssetsBuildCachePath()
+{
+	return "BuiltAssets/Cache/";
+}
+
 const char* GetEditorAssetsPath()
 {
 	return "o2/Editor/Assets/";
@@ -99,6 +110,31 @@ const char* GetEditorBuiltAssetsTreePath()
 	return "BuiltAssets/Windows/EditorData.json";
 }
 
+bool IsRenderBufferObjectsEnabled()
+{
+	return true;
+}
+
+o2::UInt GetRenderVertexRingBufferSize()
+{
+	return 1024*256;
+}
+
+o2::UInt GetRenderIndexRingBufferSize()
+{
+	return 1024*256*3;
+}
+
+int GetJobSystemWorkersCount()
+{
+	return -1;
+}
+
+float GetBakedValuesMaxRelativeError()
+{
+	return 0.01f;
+}
+
 #ifdef PLATFORM_ANDROID
 
 const char* GetAndroidAssetsPath()
@@ -15,6 +15,21 @@
 #define RENDER_DEBUG false
 #endif
 
+// Enables checking accuracy of baked curves and animation tracks after each baking. The check evaluates
+// approximation between all samples again, so it is enabled only when CHECK_BAKED_VALUES is defined
+#if defined CHECK_BAKED_VALUES
+#define BAKED_VALUES_CHECK true
+#else
+#define BAKED_VALUES_CHECK false
+#endif
+
+// Enables frame profiler scopes. Define PROFILING to enable profiler in release build
+#if defined DEBUG || defined PROFILING
+#define PROFILER_ENABLED true
+#else
+#define PROFILER_ENABLED false
+#endif
+
 // Describes that engine running as editor
 #define IS_EDITOR true
 
@@ -55,6 +70,9 @@ const char* GetBuiltAssetsPath();
 // Built assets assets tree path
 const char* GetBuiltAssetsTreePath();
 
+// Local assets build cache path, keeps expensive converters results by their inputs hashes. Relative from executable
+const char* GetAssetsBuildCachePath();
+
 // Editor's assets path. Relative from executable
 const char* GetEditorAssetsPath();
 
@@ -64,6 +82,36 @@ const char* GetEditorBuiltAssetsPath();
 // Editor's built assets assets tree path
 const char* GetEditorBuiltAssetsTreePath();
 
+// ----------------------------
+// Render configuration section
+// ----------------------------
+
+// Streaming vertices through GPU vertex and index buffer objects when available, otherwise client arrays are used
+bool IsRenderBufferObjectsEnabled();
+
+// Size of GPU vertices ring buffer in vertices. Buffers are orphaned when ring is filled
+o2::UInt GetRenderVertexRingBufferSize();
+
+// Size of GPU indexes ring buffer in indexes. Buffers are orphaned when ring is filled
+o2::UInt GetRenderIndexRingBufferSize();
+
+
+// --------------------------------
+// Job system configuration section
+// --------------------------------
+
+// Count of job system worker threads. Negative value means hardware threads count except main thread
+int GetJobSystemWorkersCount();
+
+
+// ---------------------------------
+// Animation configuration section
+// ---------------------------------
+
+// Max error of baked curves and animation tracks values relative to keys values range. Larger errors are reported
+// by baking check
+float GetBakedValuesMaxRelativeError();
+
 
 // ----------------------
 // Platform configuration
@@ -139,9 +139,9 @@ namespace o2
 	template<typename _type /*= CursorAreaEventsListener*/>
 	_type* EventSystem::GetCursorListenerUnderCursor(CursorId cursorId) const
 	{
-		if (mUnderCursorListeners.ContainsKey(cursorId))
+		if (mCursorAreaListenersBasicLayer.mUnderCursorListeners.ContainsKey(cursorId))
 		{
-			for (auto listener : mUnderCursorListeners.Get(cursorId))
+			for (auto listener : mCursorAreaListenersBasicLayer.mUnderCursorListeners.Get(cursorId))
 			{
 				if (auto tListener = dynamic_cast<_type*>(listener))
 					return tListener;
@@ -12,6 +12,7 @@
 #include "Render/Texture.h"
 #include "Utils/Debug/Debug.h"
 #include "Utils/Debug/Log/LogStream.h"
+#include "Utils/Debug/Profiler.h"
 #include "Utils/Math/Geometry.h"
 #include "Utils/Math/Interpolation.h"
 #include "Application/Input.h"
@@ -266,6 +267,10 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		PROFILE_SCOPE("Render::DrawPrimitives");
+
+		FlushRenderQueue();
+
 		if (mLastDrawVertex < 1)
 			return;
 
@@ -521,17 +526,9 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::DrawBufferImmediate(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+									 UInt16* indexes, UInt elementsCount, const TextureRef& texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount*2;
@@ -0,0 +1,77 @@
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Math/Vector2.h"
+
+namespace o2
+{
+	class Texture;
+
+	// ---------------------------------------------------------------------------------------
+	// Headless render statistics. Collects all work that would be sent to GPU by real render
+	// ---------------------------------------------------------------------------------------
+	struct RenderStatistics
+	{
+		UInt64 drawCalls = 0;           // Draw indexed primitives calls
+		UInt64 vertices = 0;            // Vertices sent to draw
+		UInt64 indexes = 0;             // Indexes sent to draw
+		UInt64 triangles = 0;           // Triangles sent to draw
+		UInt64 textureChanges = 0;      // Texture binding changes
+		UInt64 primitiveChanges = 0;    // Primitive type changes
+		UInt64 renderTargetChanges = 0; // Render target binding changes
+		UInt64 stencilChanges = 0;      // Stencil drawing or test switches
+		UInt64 scissorChanges = 0;      // Scissor rectangle changes
+		UInt64 textureUploads = 0;      // Texture data uploads
+		UInt64 textureUploadBytes = 0;  // Texture data uploads size in bytes
+
+	public:
+		// Returns total state changes count
+		UInt64 GetStateChanges() const;
+
+		// Adds other statistics
+		RenderStatistics& operator+=(const RenderStatistics& other);
+	};
+
+	// -----------------------------------------------------------------------------------
+	// Linux headless render base fields. Nothing is drawn, drawing calls are only counted
+	// -----------------------------------------------------------------------------------
+	class RenderBase
+	{
+	public:
+		// Returns statistics of current frame
+		const RenderStatistics& GetFrameStatistics() const;
+
+		// Returns statistics of last finished frame
+		const RenderStatistics& GetLastFrameStatistics() const;
+
+		// Returns statistics of all frames since render creation or last ResetStatistics() call
+		const RenderStatistics& GetTotalStatistics() const;
+
+		// Returns count of frames since render creation or last ResetStatistics() call
+		UInt64 GetStatisticsFramesCount() const;
+
+		// Resets total statistics and frames count
+		void ResetStatistics();
+
+	protected:
+		UInt8*  mVertexData;               // Vertex data buffer
+		UInt16* mVertexIndexData;          // Index data buffer
+		UInt    mVertexBufferSize = 6000;  // Maximum size of vertex buffer
+		UInt    mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		Texture* mBoundTexture = nullptr; // Texture bound at last draw call, used for counting texture changes
+
+		RenderStatistics mFrameStatistics;     // Current frame statistics
+		RenderStatistics mLastFrameStatistics; // Last finished frame statistics
+		RenderStatistics mTotalStatistics;     // Statistics of all finished frames
+		UInt64           mStatisticsFrames = 0; // Finished frames count in total statistics
+
+	protected:
+		// Finishes frame statistics: adds it to total and stores as last frame statistics
+		void FinishFrameStatistics();
+	};
+};
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,447 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+#include "o2/Render/Render.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Assets/Assets.h"
+#include "o2/EngineSettings.h"
+#include "o2/Render/Font.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
+
+namespace o2
+{
+	Render::Render() :
+		mReady(false), mStencilDrawing(false), mStencilTest(false), mClippingEverything(false)
+	{
+		mVertexBufferSize = USHRT_MAX;
+		mIndexBufferSize = USHRT_MAX;
+
+		// Create log stream
+		mLog = mnew LogStream("Render");
+		o2Debug.GetLog()->BindStream(mLog);
+
+		mLog->Out("Initializing headless render..");
+
+		mResolution = o2Application.GetContentSize();
+
+		// Check compatibles
+		CheckCompatibles();
+
+		// Initialize buffers
+		mVertexData = mnew UInt8[mVertexBufferSize * sizeof(Vertex2)];
+
+		mVertexIndexData = mnew UInt16[mIndexBufferSize];
+		mLastDrawVertex = 0;
+		mTrianglesCount = 0;
+		mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+		mDPI = Vec2I(96, 96);
+
+		InitializeFreeType();
+		InitializeLinesIndexBuffer();
+		InitializeLinesTextures();
+
+		mCurrentRenderTarget = TextureRef();
+
+		if (IsDevMode())
+			o2Assets.onAssetsRebuilt += MakeFunction(this, &Render::OnAssetsRebuilded);
+
+		mReady = true;
+	}
+
+	Render::~Render()
+	{
+		if (!mReady)
+			return;
+
+		if (IsDevMode())
+			o2Assets.onAssetsRebuilt -= MakeFunction(this, &Render::OnAssetsRebuilded);
+
+		mSolidLineTexture = TextureRef::Null();
+		mDashLineTexture = TextureRef::Null();
+
+		auto fonts = mFonts;
+		for (auto font : fonts)
+			delete font;
+
+		auto textures = mTextures;
+		for (auto texture : textures)
+			delete texture;
+
+		delete[] mVertexData;
+		delete[] mVertexIndexData;
+
+		DeinitializeFreeType();
+
+		mReady = false;
+	}
+
+	void Render::CheckCompatibles()
+	{
+		mRenderTargetsAvailable = true;
+		mMaxTextureSize = Vec2I(16384, 16384);
+	}
+
+	void Render::Begin()
+	{
+		if (!mReady)
+			return;
+
+		mLastDrawTexture = NULL;
+		mLastDrawVertex = 0;
+		mLastDrawIdx = 0;
+		mTrianglesCount = 0;
+		mFrameTrianglesCount = 0;
+		mDIPCount = 0;
+		mCurrentPrimitiveType = PrimitiveType::Polygon;
+
+		mDrawingDepth = 0.0f;
+
+		mScissorInfos.Clear();
+		mStackScissors.Clear();
+
+		mClippingEverything = false;
+
+		SetupViewMatrix(mResolution);
+		UpdateCameraTransforms();
+
+		preRender();
+		preRender.Clear();
+	}
+
+	void Render::DrawPrimitives()
+	{
+		PROFILE_SCOPE("Render::DrawPrimitives");
+
+		FlushRenderQueue();
+
+		if (mLastDrawVertex < 1)
+			return;
+
+		if (mBoundTexture != mLastDrawTexture)
+		{
+			mBoundTexture = mLastDrawTexture;
+			mFrameStatistics.textureChanges++;
+		}
+
+		mFrameStatistics.drawCalls++;
+		mFrameStatistics.vertices += mLastDrawVertex;
+		mFrameStatistics.indexes += mLastDrawIdx;
+		mFrameStatistics.triangles += mTrianglesCount;
+
+		mFrameTrianglesCount += mTrianglesCount;
+		mLastDrawVertex = mTrianglesCount = mLastDrawIdx = 0;
+
+		mDIPCount++;
+	}
+
+	void Render::SetupViewMatrix(const Vec2I& viewSize)
+	{
+		mCurrentResolution = viewSize;
+		mCamera = Camera();
+
+		UpdateCameraTransforms();
+	}
+
+	void Render::End()
+	{
+		if (!mReady)
+			return;
+
+		postRender();
+		postRender.Clear();
+
+		DrawPrimitives();
+
+		FinishFrameStatistics();
+
+		CheckTexturesUnloading();
+		CheckFontsUnloading();
+	}
+
+	void Render::Clear(const Color4& color /*= Color4::Blur()*/)
+	{}
+
+	void Render::UpdateCameraTransforms()
+	{
+		DrawPrimitives();
+
+		Vec2F resf = (Vec2F)mCurrentResolution;
+
+		Basis defaultCameraBasis((Vec2F)mCurrentResolution*-0.5f, Vec2F::Right()*resf.x, Vec2F().Up()*resf.y);
+		Basis camTransf = mCamera.GetBasis().Inverted()*defaultCameraBasis;
+		mViewScale = Vec2F(camTransf.xv.Length(), camTransf.yv.Length());
+		mInvViewScale = Vec2F(1.0f / mViewScale.x, 1.0f / mViewScale.y);
+	}
+
+	void Render::BeginRenderToStencilBuffer()
+	{
+		if (mStencilDrawing || mStencilTest)
+			return;
+
+		DrawPrimitives();
+
+		mFrameStatistics.stencilChanges++;
+		mStencilDrawing = true;
+	}
+
+	void Render::EndRenderToStencilBuffer()
+	{
+		if (!mStencilDrawing)
+			return;
+
+		DrawPrimitives();
+
+		mFrameStatistics.stencilChanges++;
+		mStencilDrawing = false;
+	}
+
+	void Render::EnableStencilTest()
+	{
+		if (mStencilTest || mStencilDrawing)
+			return;
+
+		DrawPrimitives();
+
+		mFrameStatistics.stencilChanges++;
+		mStencilTest = true;
+	}
+
+	void Render::DisableStencilTest()
+	{
+		if (!mStencilTest)
+			return;
+
+		DrawPrimitives();
+
+		mFrameStatistics.stencilChanges++;
+		mStencilTest = false;
+	}
+
+	void Render::ClearStencil()
+	{}
+
+	void Render::EnableScissorTest(const RectI& rect)
+	{
+		DrawPrimitives();
+
+		RectI summaryScissorRect = rect;
+		if (!mStackScissors.IsEmpty())
+		{
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+
+			if (!mStackScissors.Last().mRenderTarget)
+			{
+				RectI lastSummaryClipRect = mStackScissors.Last().mSummaryScissorRect;
+				mClippingEverything = !summaryScissorRect.IsIntersects(lastSummaryClipRect);
+				summaryScissorRect = summaryScissorRect.GetIntersection(lastSummaryClipRect);
+			}
+			else
+				mClippingEverything = false;
+		}
+		else
+			mClippingEverything = false;
+
+		mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
+		mStackScissors.Add(ScissorStackEntry(rect, summaryScissorRect));
+
+		mFrameStatistics.scissorChanges++;
+	}
+
+	void Render::DisableScissorTest(bool forcible /*= false*/)
+	{
+		if (mStackScissors.IsEmpty())
+		{
+			mLog->WarningStr("Can't disable scissor test - no scissor were enabled!");
+			return;
+		}
+
+		DrawPrimitives();
+
+		mFrameStatistics.scissorChanges++;
+
+		if (forcible)
+		{
+			while (!mStackScissors.IsEmpty() && !mStackScissors.Last().mRenderTarget)
+				mStackScissors.PopBack();
+
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+		}
+		else
+		{
+			if (mStackScissors.Count() == 1)
+			{
+				mStackScissors.PopBack();
+
+				mScissorInfos.Last().mEndDepth = mDrawingDepth;
+				mClippingEverything = false;
+			}
+			else
+			{
+				mStackScissors.PopBack();
+				RectI lastClipRect = mStackScissors.Last().mSummaryScissorRect;
+
+				mScissorInfos.Last().mEndDepth = mDrawingDepth;
+				mScissorInfos.Add(ScissorInfo(lastClipRect, mDrawingDepth));
+
+				if (mStackScissors.Last().mRenderTarget)
+					mClippingEverything = false;
+				else
+					mClippingEverything = lastClipRect == RectI();
+			}
+		}
+	}
+
+	void Render::DrawBufferImmediate(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+									 UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		UInt indexesCount;
+		if (primitiveType == PrimitiveType::Line)
+			indexesCount = elementsCount * 2;
+		else
+			indexesCount = elementsCount * 3;
+
+		if (mLastDrawTexture != texture.mTexture ||
+			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
+			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
+			mCurrentPrimitiveType != primitiveType)
+		{
+			DrawPrimitives();
+
+			if (mCurrentPrimitiveType != primitiveType)
+				mFrameStatistics.primitiveChanges++;
+
+			mLastDrawTexture = texture.mTexture;
+			mCurrentPrimitiveType = primitiveType;
+		}
+
+		memcpy(&mVertexData[mLastDrawVertex * sizeof(Vertex2)], vertices, sizeof(Vertex2)*verticesCount);
+
+		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount; i++, j++)
+			mVertexIndexData[i] = mLastDrawVertex + indexes[j];
+
+		if (primitiveType != PrimitiveType::Line)
+			mTrianglesCount += elementsCount;
+
+		mLastDrawVertex += verticesCount;
+		mLastDrawIdx += indexesCount;
+	}
+
+	void Render::BindRenderTexture(TextureRef renderTarget)
+	{
+		if (!renderTarget)
+		{
+			UnbindRenderTexture();
+			return;
+		}
+
+		if (renderTarget->mUsage != Texture::Usage::RenderTarget)
+		{
+			mLog->Error("Can't set texture as render target: not render target texture");
+			UnbindRenderTexture();
+			return;
+		}
+
+		if (!renderTarget->IsReady())
+		{
+			mLog->Error("Can't set texture as render target: texture isn't ready");
+			UnbindRenderTexture();
+			return;
+		}
+
+		DrawPrimitives();
+
+		if (!mStackScissors.IsEmpty())
+			mScissorInfos.Last().mEndDepth = mDrawingDepth;
+
+		mStackScissors.Add(ScissorStackEntry(RectI(), RectI(), true));
+
+		mFrameStatistics.renderTargetChanges++;
+
+		SetupViewMatrix(renderTarget->GetSize());
+
+		mCurrentRenderTarget = renderTarget;
+	}
+
+	void Render::UnbindRenderTexture()
+	{
+		if (!mCurrentRenderTarget)
+			return;
+
+		DrawPrimitives();
+
+		mFrameStatistics.renderTargetChanges++;
+
+		SetupViewMatrix(mResolution);
+
+		mCurrentRenderTarget = TextureRef();
+
+		DisableScissorTest(true);
+		mStackScissors.PopBack();
+		if (!mStackScissors.IsEmpty())
+			mClippingEverything = mStackScissors.Last().mSummaryScissorRect == RectI();
+	}
+
+	const RenderStatistics& RenderBase::GetFrameStatistics() const
+	{
+		return mFrameStatistics;
+	}
+
+	const RenderStatistics& RenderBase::GetLastFrameStatistics() const
+	{
+		return mLastFrameStatistics;
+	}
+
+	const RenderStatistics& RenderBase::GetTotalStatistics() const
+	{
+		return mTotalStatistics;
+	}
+
+	UInt64 RenderBase::GetStatisticsFramesCount() const
+	{
+		return mStatisticsFrames;
+	}
+
+	void RenderBase::ResetStatistics()
+	{
+		mTotalStatistics = RenderStatistics();
+		mStatisticsFrames = 0;
+	}
+
+	void RenderBase::FinishFrameStatistics()
+	{
+		mTotalStatistics += mFrameStatistics;
+		mStatisticsFrames++;
+
+		mLastFrameStatistics = mFrameStatistics;
+		mFrameStatistics = RenderStatistics();
+	}
+
+	UInt64 RenderStatistics::GetStateChanges() const
+	{
+		return textureChanges + primitiveChanges + renderTargetChanges + stencilChanges + scissorChanges;
+	}
+
+	RenderStatistics& RenderStatistics::operator+=(const RenderStatistics& other)
+	{
+		drawCalls += other.drawCalls;
+		vertices += other.vertices;
+		indexes += other.indexes;
+		triangles += other.triangles;
+		textureChanges += other.textureChanges;
+		primitiveChanges += other.primitiveChanges;
+		renderTargetChanges += other.renderTargetChanges;
+		stencilChanges += other.stencilChanges;
+		scissorChanges += other.scissorChanges;
+		textureUploads += other.textureUploads;
+		textureUploadBytes += other.textureUploadBytes;
+
+		return *this;
+	}
+}
+
+#endif // PLATFORM_LINUX
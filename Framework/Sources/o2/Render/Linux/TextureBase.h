@@ -0,0 +1,19 @@
+#pragma once
+
+#ifdef PLATFORM_LINUX
+
+namespace o2
+{
+	class Bitmap;
+
+	class TextureBase
+	{
+		friend class Render;
+		friend class VectorFont;
+
+	protected:
+		Bitmap* mData = nullptr; // Texture pixels copy in memory, there is no GPU storage in headless render
+	};
+}
+
+#endif // PLATFORM_LINUX
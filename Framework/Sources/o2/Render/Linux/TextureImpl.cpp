@@ -0,0 +1,94 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+#include "o2/Render/Texture.h"
+
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+
+namespace o2
+{
+	Texture::~Texture()
+	{
+		o2Render.mTextures.Remove(this);
+
+		delete mData;
+	}
+
+	void Texture::Create(const Vec2I& size, PixelFormat format /*= Format::R8G8B8A8*/, Usage usage /*= Usage::Default*/)
+	{
+		delete mData;
+
+		mFormat = format;
+		mUsage = usage;
+		mSize = size;
+
+		mData = mnew Bitmap(format, size);
+
+		mReady = true;
+	}
+
+	void Texture::Create(Bitmap* bitmap)
+	{
+		delete mData;
+
+		mFormat = bitmap->GetFormat();
+		mUsage = Usage::Default;
+		mSize = bitmap->GetSize();
+		mFileName = bitmap->GetFilename();
+
+		mData = mnew Bitmap(*bitmap);
+
+		o2Render.mFrameStatistics.textureUploads++;
+		o2Render.mFrameStatistics.textureUploadBytes += mSize.x*mSize.y*(mFormat == PixelFormat::R8G8B8A8 ? 4 : 3);
+
+		mReady = true;
+	}
+
+	void Texture::SetData(Bitmap* bitmap)
+	{
+		delete mData;
+
+		mSize = bitmap->GetSize();
+		mData = mnew Bitmap(*bitmap);
+
+		o2Render.mFrameStatistics.textureUploads++;
+		o2Render.mFrameStatistics.textureUploadBytes += mSize.x*mSize.y*(mFormat == PixelFormat::R8G8B8A8 ? 4 : 3);
+	}
+
+	void Texture::SetSubData(const Vec2I& offset, Bitmap* bitmap)
+	{
+		if (mData)
+			mData->CopyImage(bitmap, offset);
+
+		Vec2I size = bitmap->GetSize();
+		o2Render.mFrameStatistics.textureUploads++;
+		o2Render.mFrameStatistics.textureUploadBytes += size.x*size.y*(mFormat == PixelFormat::R8G8B8A8 ? 4 : 3);
+	}
+
+	void Texture::Copy(const Texture& from, const RectI& rect)
+	{
+		if (mData && from.mData)
+			mData->CopyImage(from.mData, Vec2I(), rect);
+	}
+
+	Bitmap* Texture::GetData()
+	{
+		if (mData)
+			return mnew Bitmap(*mData);
+
+		return mnew Bitmap(mFormat, mSize);
+	}
+
+	void Texture::SetFilter(Filter filter)
+	{
+		mFilter = filter;
+	}
+
+	Texture::Filter Texture::GetFilter() const
+	{
+		return mFilter;
+	}
+}
+
+#endif //PLATFORM_LINUX
@@ -77,6 +77,11 @@ namespace o2
 		return mTexture;
 	}
 
+	Texture* Mesh::GetTexturePtr() const
+	{
+		return mTexture.Get();
+	}
+
 	void Mesh::SetMaxVertexCount(const UInt& count)
 	{
 		delete[] vertices;
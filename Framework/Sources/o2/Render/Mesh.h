@@ -52,6 +52,9 @@ namespace o2
 		// Returns texture ptr
 		TextureRef GetTexture() const;
 
+		// Returns texture pointer without changing texture references counter
+		Texture* GetTexturePtr() const;
+
 		// Sets max vertex count buffer
 		void SetMaxVertexCount(const UInt& count);
 
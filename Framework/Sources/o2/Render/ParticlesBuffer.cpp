@@ -0,0 +1,324 @@
+#include "o2/stdafx.h"
+#include "ParticlesBuffer.h"
+
+#include "o2/Utils/Math/Vertex2.h"
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define PARTICLES_SSE
+#include <emmintrin.h>
+#endif
+
+namespace o2
+{
+	// dst[i] += src[i]*k
+	static void MulAdd(float* dst, const float* src, float k, int count)
+	{
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 vk = _mm_set1_ps(k);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), vk)));
+#endif
+
+		for (; i < count; i++)
+			dst[i] += src[i]*k;
+	}
+
+	// dst[i] += a[i]*b[i]*k
+	static void MulMulAdd(float* dst, const float* a, const float* b, float k, int count)
+	{
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 vk = _mm_set1_ps(k);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 ab = _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+			_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(ab, vk)));
+		}
+#endif
+
+		for (; i < count; i++)
+			dst[i] += a[i]*b[i]*k;
+	}
+
+	// dst[i] += value
+	static void AddScalar(float* dst, float value, int count)
+	{
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 vvalue = _mm_set1_ps(value);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), vvalue));
+#endif
+
+		for (; i < count; i++)
+			dst[i] += value;
+	}
+
+#ifdef PARTICLES_SSE
+	// Calculates sine and cosine of four angles. Cephes polynomial approximation, precise for angles up to 8192
+	static void SinCos(__m128 x, __m128& sin, __m128& cos)
+	{
+		const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+
+		__m128 signBitSin = _mm_and_ps(x, signMask);
+		x = _mm_andnot_ps(signMask, x);
+
+		// Octant of angle, rounded to even
+		__m128i octant = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+		octant = _mm_add_epi32(octant, _mm_set1_epi32(1));
+		octant = _mm_and_si128(octant, _mm_set1_epi32(~1));
+		__m128 y = _mm_cvtepi32_ps(octant);
+
+		__m128 swapSignBitSin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29));
+		__m128 polyMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_setzero_si128()));
+		__m128 signBitCos = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(octant, _mm_set1_epi32(2)),
+																				_mm_set1_epi32(4)), 29));
+
+		signBitSin = _mm_xor_ps(signBitSin, swapSignBitSin);
+
+		// Reduce angle into [-pi/4, pi/4] with extended precision
+		x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-0.78515625f)));
+		x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-2.4187564849853515625e-4f)));
+		x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-3.77489497744594108e-8f)));
+
+		__m128 z = _mm_mul_ps(x, x);
+
+		__m128 cosPoly = _mm_set1_ps(2.443315711809948e-5f);
+		cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(-1.388731625493765e-3f));
+		cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(4.166664568298827e-2f));
+		cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+		cosPoly = _mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+		cosPoly = _mm_add_ps(cosPoly, _mm_set1_ps(1.0f));
+
+		__m128 sinPoly = _mm_set1_ps(-1.9515295891e-4f);
+		sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(8.3321608736e-3f));
+		sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(-1.6666654611e-1f));
+		sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), x), x);
+
+		// Polynomials are swapped in odd quadrants
+		__m128 sinValue = _mm_or_ps(_mm_and_ps(polyMask, sinPoly), _mm_andnot_ps(polyMask, cosPoly));
+		__m128 cosValue = _mm_or_ps(_mm_and_ps(polyMask, cosPoly), _mm_andnot_ps(polyMask, sinPoly));
+
+		sin = _mm_xor_ps(sinValue, signBitSin);
+		cos = _mm_xor_ps(cosValue, signBitCos);
+	}
+#endif
+
+	// Writes particle quad: center o, half axes xv and yv
+	static inline void WriteQuad(Vertex2* vertices, float ox, float oy, float xvx, float xvy, float yvx, float yvy,
+								 ULong color, float uvLeft, float uvRight, float uvUp, float uvDown)
+	{
+		vertices[0].Set(ox - xvx + yvx, oy - xvy + yvy, color, uvLeft, uvUp);
+		vertices[1].Set(ox + xvx + yvx, oy + xvy + yvy, color, uvRight, uvUp);
+		vertices[2].Set(ox + xvx - yvx, oy + xvy - yvy, color, uvRight, uvDown);
+		vertices[3].Set(ox - xvx - yvx, oy - xvy - yvy, color, uvLeft, uvDown);
+	}
+
+	int ParticlesBuffer::Count() const
+	{
+		return positionX.Count();
+	}
+
+	bool ParticlesBuffer::IsEmpty() const
+	{
+		return positionX.IsEmpty();
+	}
+
+	int ParticlesBuffer::Add(const Particle& particle)
+	{
+		positionX.Add(particle.position.x);
+		positionY.Add(particle.position.y);
+		velocityX.Add(particle.velocity.x);
+		velocityY.Add(particle.velocity.y);
+		angle.Add(particle.angle);
+		angleSpeed.Add(particle.angleSpeed);
+		sizeX.Add(particle.size.x);
+		sizeY.Add(particle.size.y);
+		color.Add(particle.color);
+		time.Add(particle.time);
+		lifetime.Add(particle.time);
+		phase.Add(0.0f);
+		speedScale.Add(1.0f);
+
+		emitSizeX.Add(particle.size.x);
+		emitSizeY.Add(particle.size.y);
+		emitAngleSpeed.Add(particle.angleSpeed);
+		emitColor.Add(particle.color);
+
+		return positionX.Count() - 1;
+	}
+
+	Particle ParticlesBuffer::Get(int idx) const
+	{
+		Particle res;
+		res.position.Set(positionX[idx], positionY[idx]);
+		res.velocity.Set(velocityX[idx], velocityY[idx]);
+		res.angle = angle[idx];
+		res.angleSpeed = angleSpeed[idx];
+		res.size.Set(sizeX[idx], sizeY[idx]);
+		res.color = color[idx];
+		res.time = time[idx];
+		res.alive = true;
+
+		return res;
+	}
+
+	void ParticlesBuffer::Remove(int idx)
+	{
+		int last = Count() - 1;
+		if (idx != last)
+			ForEachArray([&](auto& array) { array[idx] = array[last]; });
+
+		Truncate(last);
+	}
+
+	void ParticlesBuffer::Truncate(int count)
+	{
+		if (count >= Count())
+			return;
+
+		ForEachArray([&](auto& array) { array.Resize(count); });
+	}
+
+	void ParticlesBuffer::Clear()
+	{
+		Truncate(0);
+	}
+
+	void ParticlesBuffer::UpdatePhases()
+	{
+		int count = Count();
+		if (count == 0)
+			return;
+
+		float* phases = phase.Data();
+		const float* times = time.Data();
+		const float* lifetimes = lifetime.Data();
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), epsilon = _mm_set1_ps(FLT_EPSILON);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 relative = _mm_div_ps(_mm_loadu_ps(times + i), _mm_max_ps(_mm_loadu_ps(lifetimes + i), epsilon));
+			_mm_storeu_ps(phases + i, _mm_min_ps(_mm_max_ps(_mm_sub_ps(one, relative), zero), one));
+		}
+#endif
+
+		for (; i < count; i++)
+			phases[i] = Math::Clamp01(1.0f - times[i]/Math::Max(lifetimes[i], FLT_EPSILON));
+	}
+
+	void ParticlesBuffer::Integrate(float dt)
+	{
+		int count = Count();
+		if (count == 0)
+			return;
+
+		MulMulAdd(positionX.Data(), velocityX.Data(), speedScale.Data(), dt, count);
+		MulMulAdd(positionY.Data(), velocityY.Data(), speedScale.Data(), dt, count);
+		MulAdd(angle.Data(), angleSpeed.Data(), dt, count);
+		AddScalar(time.Data(), -dt, count);
+	}
+
+	void ParticlesBuffer::RemoveDead()
+	{
+		for (int i = 0; i < Count(); )
+		{
+			if (time[i] < 0)
+				Remove(i);
+			else
+				i++;
+		}
+	}
+
+	void ParticlesBuffer::AddVelocity(const Vec2F& delta)
+	{
+		int count = Count();
+		if (count == 0)
+			return;
+
+		AddScalar(velocityX.Data(), delta.x, count);
+		AddScalar(velocityY.Data(), delta.y, count);
+	}
+
+	void ParticlesBuffer::Transform(const Basis& basis)
+	{
+		int count = Count();
+		if (count == 0)
+			return;
+
+		float* xs = positionX.Data();
+		float* ys = positionY.Data();
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 xvx = _mm_set1_ps(basis.xv.x), xvy = _mm_set1_ps(basis.xv.y);
+		__m128 yvx = _mm_set1_ps(basis.yv.x), yvy = _mm_set1_ps(basis.yv.y);
+		__m128 ox = _mm_set1_ps(basis.origin.x), oy = _mm_set1_ps(basis.origin.y);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(xs + i), y = _mm_loadu_ps(ys + i);
+			_mm_storeu_ps(xs + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xvx, x), _mm_mul_ps(yvx, y)), ox));
+			_mm_storeu_ps(ys + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xvy, x), _mm_mul_ps(yvy, y)), oy));
+		}
+#endif
+
+		for (; i < count; i++)
+			basis.Transform(xs[i], ys[i]);
+	}
+
+	void ParticlesBuffer::BuildQuads(Vertex2* vertices, float uvLeft, float uvRight, float uvUp, float uvDown) const
+	{
+		int count = Count();
+		if (count == 0)
+			return;
+
+		const float* px = &positionX[0];
+		const float* py = &positionY[0];
+		const float* angles = &angle[0];
+		const float* sx = &sizeX[0];
+		const float* sy = &sizeY[0];
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		// Quads axes are calculated for four particles at once, vertices are written per particle
+		alignas(16) float xvx[4], xvy[4], yvx[4], yvy[4];
+		__m128 half = _mm_set1_ps(0.5f);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 sn, cs;
+			SinCos(_mm_loadu_ps(angles + i), sn, cs);
+
+			__m128 hsx = _mm_mul_ps(_mm_loadu_ps(sx + i), half);
+			__m128 hsy = _mm_mul_ps(_mm_loadu_ps(sy + i), half);
+
+			_mm_store_ps(xvx, _mm_mul_ps(cs, hsx));
+			_mm_store_ps(xvy, _mm_mul_ps(sn, hsx));
+			_mm_store_ps(yvx, _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(sn, hsy)));
+			_mm_store_ps(yvy, _mm_mul_ps(cs, hsy));
+
+			for (int j = 0; j < 4; j++)
+			{
+				WriteQuad(vertices + (i + j)*4, px[i + j], py[i + j], xvx[j], xvy[j], yvx[j], yvy[j],
+						  color[i + j].ARGB(), uvLeft, uvRight, uvUp, uvDown);
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			float sn = Math::Sin(angles[i]), cs = Math::Cos(angles[i]);
+			float hsx = sx[i]*0.5f, hsy = sy[i]*0.5f;
+
+			WriteQuad(vertices + i*4, px[i], py[i], cs*hsx, sn*hsx, -sn*hsy, cs*hsy,
+					  color[i].ARGB(), uvLeft, uvRight, uvUp, uvDown);
+		}
+	}
+}
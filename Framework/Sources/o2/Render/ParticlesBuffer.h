@@ -0,0 +1,106 @@
+#pragma once
+
+#include "o2/Render/Particle.h"
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Vertex2;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Particles storage as structure of arrays. Only alive particles are stored: removed particle is replaced
+	// by last one, so arrays are dense and kernels process them four particles at once with SSE. Platforms
+	// without SSE use scalar kernels. Particles order isn't kept when removing
+	// -------------------------------------------------------------------------------------------------------
+	class ParticlesBuffer
+	{
+	public:
+		Vector<float>  positionX;  // Particles centers x
+		Vector<float>  positionY;  // Particles centers y
+		Vector<float>  velocityX;  // Particles velocities x
+		Vector<float>  velocityY;  // Particles velocities y
+		Vector<float>  angle;      // Particles angles in radians
+		Vector<float>  angleSpeed; // Particles angle speeds in radians/sec
+		Vector<float>  sizeX;      // Particles widths
+		Vector<float>  sizeY;      // Particles heights
+		Vector<Color4> color;      // Particles colors
+		Vector<float>  time;       // Particles estimate life times
+		Vector<float>  lifetime;   // Particles full life times
+		Vector<float>  phase;      // Particles normalized ages: 0 when emitted and 1 at the end of life. Updated by UpdatePhases
+		Vector<float>  speedScale; // Particles speed multipliers, applied when integrating
+
+		Vector<float>  emitSizeX;      // Particles widths when emitted
+		Vector<float>  emitSizeY;      // Particles heights when emitted
+		Vector<float>  emitAngleSpeed; // Particles angle speeds when emitted
+		Vector<Color4> emitColor;      // Particles colors when emitted
+
+	public:
+		// Returns count of particles
+		int Count() const;
+
+		// Returns true when there is no particles
+		bool IsEmpty() const;
+
+		// Adds particle and returns its index
+		int Add(const Particle& particle);
+
+		// Returns particle by index
+		Particle Get(int idx) const;
+
+		// Removes particle by index, last particle is moved to its place
+		void Remove(int idx);
+
+		// Removes particles after count
+		void Truncate(int count);
+
+		// Removes all particles
+		void Clear();
+
+		// Calculates particles normalized ages from estimate and full life times
+		void UpdatePhases();
+
+		// Moves particles by scaled velocities, rotates them by angle speeds and decreases life times
+		void Integrate(float dt);
+
+		// Removes particles with expired life time
+		void RemoveDead();
+
+		// Adds delta to velocities of all particles
+		void AddVelocity(const Vec2F& delta);
+
+		// Transforms positions of all particles by basis
+		void Transform(const Basis& basis);
+
+		// Writes rotated particles quads into vertices, four vertices per particle. Texture coordinates are same
+		// for all particles
+		void BuildQuads(Vertex2* vertices, float uvLeft, float uvRight, float uvUp, float uvDown) const;
+
+	protected:
+		// Calls function for each particles array
+		template<typename _func>
+		void ForEachArray(_func func);
+	};
+
+	template<typename _func>
+	void ParticlesBuffer::ForEachArray(_func func)
+	{
+		func(positionX);
+		func(positionY);
+		func(velocityX);
+		func(velocityY);
+		func(angle);
+		func(angleSpeed);
+		func(sizeX);
+		func(sizeY);
+		func(color);
+		func(time);
+		func(lifetime);
+		func(phase);
+		func(speedScale);
+		func(emitSizeX);
+		func(emitSizeY);
+		func(emitAngleSpeed);
+		func(emitColor);
+	}
+}
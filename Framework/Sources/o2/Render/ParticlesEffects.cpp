@@ -8,19 +8,146 @@ namespace o2
 	void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
 	{}
 
-	Vector<Particle>& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
+	ParticlesBuffer& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
 	{
 		return emitter->mParticles;
 	}
 
 	void ParticlesGravityEffect::Update(float dt, ParticlesEmitter* emitter)
 	{
-		Vec2F v = gravity*dt;
-		for (auto& p : GetParticlesDirect(emitter))
-			p.velocity += v;
+		GetParticlesDirect(emitter).AddVelocity(gravity*dt);
+	}
+
+	void ParticlesCurveTable::Bake(const Curve& curve)
+	{
+		for (int i = 0; i < SamplesCount; i++)
+			mSamples[i] = curve.Evaluate((float)i/(float)(SamplesCount - 1));
+
+		mSamples[SamplesCount] = mSamples[SamplesCount - 1];
+	}
+
+	void ParticlesCurveTable::Evaluate(const float* phases, float* values, int count) const
+	{
+		const float scale = (float)(SamplesCount - 1);
+		for (int i = 0; i < count; i++)
+		{
+			float position = phases[i]*scale;
+			int sample = (int)position;
+			float coef = position - (float)sample;
+
+			values[i] = mSamples[sample] + (mSamples[sample + 1] - mSamples[sample])*coef;
+		}
+	}
+
+	ParticlesLifetimeEffect::ParticlesLifetimeEffect()
+	{
+		curve.onKeysChanged.Add(this, &ParticlesLifetimeEffect::OnCurveChanged);
+		OnCurveChanged();
+	}
+
+	ParticlesLifetimeEffect::ParticlesLifetimeEffect(const ParticlesLifetimeEffect& other):
+		ParticlesEffect(other), curve(other.curve), mCurveTable(other.mCurveTable)
+	{
+		curve.onKeysChanged.Add(this, &ParticlesLifetimeEffect::OnCurveChanged);
+	}
+
+	ParticlesLifetimeEffect& ParticlesLifetimeEffect::operator=(const ParticlesLifetimeEffect& other)
+	{
+		ParticlesEffect::operator=(other);
+		curve = other.curve;
+
+		return *this;
+	}
+
+	const Vector<float>& ParticlesLifetimeEffect::EvaluateCurve(const ParticlesBuffer& particles)
+	{
+		int count = particles.Count();
+		mValues.Resize(count);
+
+		if (count > 0)
+			mCurveTable.Evaluate(&particles.phase[0], mValues.Data(), count);
+
+		return mValues;
+	}
+
+	void ParticlesLifetimeEffect::OnCurveChanged()
+	{
+		mCurveTable.Bake(curve);
+	}
+
+	ParticlesColorOverLifetimeEffect::ParticlesColorOverLifetimeEffect()
+	{
+		curve = Curve::Linear();
+	}
+
+	void ParticlesColorOverLifetimeEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		ParticlesBuffer& particles = GetParticlesDirect(emitter);
+		const Vector<float>& coefs = EvaluateCurve(particles);
+
+		for (int i = 0; i < coefs.Count(); i++)
+			particles.color[i] = particles.emitColor[i]*Math::Lerp(beginColor, endColor, coefs[i]);
+	}
+
+	ParticlesSizeOverLifetimeEffect::ParticlesSizeOverLifetimeEffect()
+	{
+		curve.InsertFlatKey(0.0f, 1.0f);
+		curve.InsertFlatKey(1.0f, 1.0f);
+	}
+
+	void ParticlesSizeOverLifetimeEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		ParticlesBuffer& particles = GetParticlesDirect(emitter);
+		const Vector<float>& scales = EvaluateCurve(particles);
+
+		for (int i = 0; i < scales.Count(); i++)
+		{
+			particles.sizeX[i] = particles.emitSizeX[i]*scales[i];
+			particles.sizeY[i] = particles.emitSizeY[i]*scales[i];
+		}
+	}
+
+	ParticlesSpeedOverLifetimeEffect::ParticlesSpeedOverLifetimeEffect()
+	{
+		curve.InsertFlatKey(0.0f, 1.0f);
+		curve.InsertFlatKey(1.0f, 1.0f);
+	}
+
+	void ParticlesSpeedOverLifetimeEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		ParticlesBuffer& particles = GetParticlesDirect(emitter);
+		const Vector<float>& scales = EvaluateCurve(particles);
+
+		for (int i = 0; i < scales.Count(); i++)
+			particles.speedScale[i] = scales[i];
+	}
+
+	ParticlesRotationOverLifetimeEffect::ParticlesRotationOverLifetimeEffect()
+	{
+		curve.InsertFlatKey(0.0f, 0.0f);
+		curve.InsertFlatKey(1.0f, 0.0f);
+	}
+
+	void ParticlesRotationOverLifetimeEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		ParticlesBuffer& particles = GetParticlesDirect(emitter);
+		const Vector<float>& speeds = EvaluateCurve(particles);
+
+		for (int i = 0; i < speeds.Count(); i++)
+			particles.angleSpeed[i] = particles.emitAngleSpeed[i] + Math::Deg2rad(speeds[i]);
 	}
 }
 
 DECLARE_CLASS(o2::ParticlesEffect);
 
 DECLARE_CLASS(o2::ParticlesGravityEffect);
+
+DECLARE_CLASS(o2::ParticlesLifetimeEffect);
+
+DECLARE_CLASS(o2::ParticlesColorOverLifetimeEffect);
+
+DECLARE_CLASS(o2::ParticlesSizeOverLifetimeEffect);
+
+DECLARE_CLASS(o2::ParticlesSpeedOverLifetimeEffect);
+
+DECLARE_CLASS(o2::ParticlesRotationOverLifetimeEffect);
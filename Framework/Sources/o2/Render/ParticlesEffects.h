@@ -1,7 +1,8 @@
 #pragma once
 
 #include "o2/Utils/Serialization/Serializable.h"
-#include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesBuffer.h"
+#include "o2/Utils/Math/Curve.h"
 
 namespace o2
 {
@@ -16,7 +17,7 @@ namespace o2
 
 	public:
 		virtual void Update(float dt, ParticlesEmitter* emitter);
-		Vector<Particle>& GetParticlesDirect(ParticlesEmitter* emitter);
+		ParticlesBuffer& GetParticlesDirect(ParticlesEmitter* emitter);
 	};
 
 	class ParticlesGravityEffect : public ParticlesEffect
@@ -29,6 +30,120 @@ namespace o2
 	public:
 		void Update(float dt, ParticlesEmitter* emitter) override;
 	};
+
+	// -------------------------------------------------------------------------------------------------------
+	// Curve baked into uniform samples over particles normalized age. Values are interpolated between nearest
+	// samples for all particles in one loop, without searching curve keys
+	// -------------------------------------------------------------------------------------------------------
+	class ParticlesCurveTable
+	{
+	public:
+		static constexpr int SamplesCount = 128; // Count of baked samples
+
+	public:
+		// Bakes curve on positions from 0 to 1
+		void Bake(const Curve& curve);
+
+		// Evaluates values by particles normalized ages
+		void Evaluate(const float* phases, float* values, int count) const;
+
+	protected:
+		float mSamples[SamplesCount + 1] = {}; // Baked samples, last sample is duplicated for interpolation at the end
+	};
+
+	// ----------------------------------------------------------------------------------------------------
+	// Base over lifetime effect. Curve positions are particles normalized ages from 0 to 1. Curve is baked
+	// into table when its keys are changed, effect evaluates table for all particles
+	// ----------------------------------------------------------------------------------------------------
+	class ParticlesLifetimeEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesLifetimeEffect);
+
+	public:
+		Curve curve; // Value by particle normalized age @SERIALIZABLE
+
+	public:
+		// Default constructor
+		ParticlesLifetimeEffect();
+
+		// Copy-constructor
+		ParticlesLifetimeEffect(const ParticlesLifetimeEffect& other);
+
+		// Copy-operator
+		ParticlesLifetimeEffect& operator=(const ParticlesLifetimeEffect& other);
+
+	protected:
+		ParticlesCurveTable mCurveTable; // Baked curve
+		Vector<float>       mValues;     // Evaluated curve values for particles, reused between updates
+
+	protected:
+		// Evaluates baked curve for all particles into mValues and returns it
+		const Vector<float>& EvaluateCurve(const ParticlesBuffer& particles);
+
+		// It is called when curve keys are changed, bakes curve
+		void OnCurveChanged();
+	};
+
+	// -------------------------------------------------------------------------------------------------------
+	// Color over lifetime effect. Particle's emitted color is multiplied by gradient from begin to end color,
+	// curve is gradient coefficient
+	// -------------------------------------------------------------------------------------------------------
+	class ParticlesColorOverLifetimeEffect: public ParticlesLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesColorOverLifetimeEffect);
+
+	public:
+		Color4 beginColor = Color4::White(); // Gradient color at coefficient 0 @SERIALIZABLE
+		Color4 endColor = Color4::White();   // Gradient color at coefficient 1 @SERIALIZABLE
+
+	public:
+		// Default constructor, linear gradient
+		ParticlesColorOverLifetimeEffect();
+
+		void Update(float dt, ParticlesEmitter* emitter) override;
+	};
+
+	// --------------------------------------------------------------
+	// Size over lifetime effect. Curve is multiplier of emitted size
+	// --------------------------------------------------------------
+	class ParticlesSizeOverLifetimeEffect: public ParticlesLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesSizeOverLifetimeEffect);
+
+	public:
+		// Default constructor, constant multiplier 1
+		ParticlesSizeOverLifetimeEffect();
+
+		void Update(float dt, ParticlesEmitter* emitter) override;
+	};
+
+	// -----------------------------------------------------------------------
+	// Speed over lifetime effect. Curve is multiplier of particles velocities
+	// -----------------------------------------------------------------------
+	class ParticlesSpeedOverLifetimeEffect: public ParticlesLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesSpeedOverLifetimeEffect);
+
+	public:
+		// Default constructor, constant multiplier 1
+		ParticlesSpeedOverLifetimeEffect();
+
+		void Update(float dt, ParticlesEmitter* emitter) override;
+	};
+
+	// -----------------------------------------------------------------------------------------------
+	// Rotation over lifetime effect. Curve is angle speed in degrees/sec added to emitted angle speed
+	// -----------------------------------------------------------------------------------------------
+	class ParticlesRotationOverLifetimeEffect: public ParticlesLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesRotationOverLifetimeEffect);
+
+	public:
+		// Default constructor, zero angle speed
+		ParticlesRotationOverLifetimeEffect();
+
+		void Update(float dt, ParticlesEmitter* emitter) override;
+	};
 }
 
 CLASS_BASES_META(o2::ParticlesEffect)
@@ -44,7 +159,7 @@ CLASS_METHODS_META(o2::ParticlesEffect)
 {
 
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
-	PUBLIC_FUNCTION(Vector<Particle>&, GetParticlesDirect, ParticlesEmitter*);
+	PUBLIC_FUNCTION(ParticlesBuffer&, GetParticlesDirect, ParticlesEmitter*);
 }
 END_META;
 
@@ -64,3 +179,89 @@ CLASS_METHODS_META(o2::ParticlesGravityEffect)
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
 }
 END_META;
+
+CLASS_BASES_META(o2::ParticlesLifetimeEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesLifetimeEffect)
+{
+	PUBLIC_FIELD(curve).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mCurveTable);
+	PROTECTED_FIELD(mValues);
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesLifetimeEffect)
+{
+
+	PROTECTED_FUNCTION(const Vector<float>&, EvaluateCurve, const ParticlesBuffer&);
+	PROTECTED_FUNCTION(void, OnCurveChanged);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesColorOverLifetimeEffect)
+{
+	BASE_CLASS(o2::ParticlesLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesColorOverLifetimeEffect)
+{
+	PUBLIC_FIELD(beginColor).DEFAULT_VALUE(Color4::White()).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(endColor).DEFAULT_VALUE(Color4::White()).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesColorOverLifetimeEffect)
+{
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesSizeOverLifetimeEffect)
+{
+	BASE_CLASS(o2::ParticlesLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesSizeOverLifetimeEffect)
+{
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesSizeOverLifetimeEffect)
+{
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesSpeedOverLifetimeEffect)
+{
+	BASE_CLASS(o2::ParticlesLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesSpeedOverLifetimeEffect)
+{
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesSpeedOverLifetimeEffect)
+{
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesRotationOverLifetimeEffect)
+{
+	BASE_CLASS(o2::ParticlesLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesRotationOverLifetimeEffect)
+{
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesRotationOverLifetimeEffect)
+{
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+}
+END_META;
@@ -4,6 +4,7 @@
 #include "o2/Render/Mesh.h"
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
+#include <atomic>
 
 namespace o2
 {
@@ -13,6 +14,9 @@ namespace o2
 		mShape = mnew CircleParticlesEmitterShape();
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
 		mLastTransform = mTransform;
+
+		// Deserialized emitter restores its own seed in OnDeserialized
+		SetRandomSeed(MakeRandomSeed());
 	}
 
 	ParticlesEmitter::~ParticlesEmitter()
@@ -38,13 +42,15 @@ namespace o2
 		duration(this), particlesLifetime(this), emitParticlesPerSecond(this), emitParticlesAngle(this), emitParticlesAngleRange(this),
 		emitParticlesSize(this), emitParticlesSizeRange(this), emitParticlesSpeed(this), emitParticlesAngleSpeedRange(this), emitParticlesAngleSpeed(this),
 		emitParticlesSpeedRange(this), emitParticlesMoveDir(this), emitParticlesMoveDirRange(this), emitParticlesColorA(this), emitParticlesColorB(this),
-		image(this), shape(this)
+		image(this), shape(this), randomSeed(this)
 	{
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->CloneAs<ParticlesEffect>());
 
+		SetRandomSeed(MakeRandomSeed(other.mRandomSeed));
+
 		mLastTransform = mTransform;
 	}
 
@@ -53,18 +59,7 @@ namespace o2
 		RemoveAllEffects();
 		delete mShape;
 
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (particle.alive)
-			{
-				mDeadParticles.Add(idx);
-				particle.alive = false;
-			}
-
-			idx++;
-		}
-		mNumAliveParticles = 0;
+		mParticles.Clear();
 
 		IRectDrawable::operator=(other);
 
@@ -104,9 +99,12 @@ namespace o2
 		mEmitParticlesColorA = other.mEmitParticlesColorA;
 		mEmitParticlesColorB = other.mEmitParticlesColorB;
 
+		SetRandomSeed(MakeRandomSeed(other.mRandomSeed));
+
 		mParticlesMesh->vertexCount = 0;
 		mParticlesMesh->polyCount = 0;
 		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mIndexedQuadsCount = 0;
 
 		mLastTransform = mTransform;
 
@@ -135,6 +133,7 @@ namespace o2
 		}
 
 		UpdateEmitting(dt);
+		mParticles.UpdatePhases();
 		UpdateEffects(dt);
 		UpdateParticles(dt);
 		UpdateMesh();
@@ -160,36 +159,29 @@ namespace o2
 		float halfAngleSpeedRange = mEmitParticlesAngleSpeedRange*0.5f;
 		while (mEmitTimeBuffer > particlesDelay)
 		{
-			if (mNumAliveParticles < mParticlesNumLimit)
+			if (mParticles.Count() < mParticlesNumLimit)
 			{
-				Particle* p;
-
-				if (mDeadParticles.IsEmpty())
-				{
-					mParticles.Add(Particle());
-					p = &mParticles.Last();
-				}
-				else p = &mParticles[mDeadParticles.PopBack()];
+				Particle p;
 
-				p->position = Local2WorldPoint(mShape->GetEmittinPoint());
-				p->angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
+				p.position = Local2WorldPoint(mShape->GetEmittinPoint(mRandom));
+				p.angle = mEmitParticlesAngle + mRandom.Random(-halfAngleRange, halfAngleRange);
 
-				p->size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
-							mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
+				p.size.Set(mEmitParticlesSize.x + mRandom.Random(-halfSizeRange.x, halfSizeRange.x),
+						   mEmitParticlesSize.y + mRandom.Random(-halfSizeRange.y, halfSizeRange.y));
 
-				p->velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
-					(mEmitParticlesSpeed + Math::Random(-halfSpeedRange, halfSpeedRange));
+				p.velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + mRandom.Random(-halfDirRange, halfDirRange))*
+					(mEmitParticlesSpeed + mRandom.Random(-halfSpeedRange, halfSpeedRange));
 
-				p->angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
+				p.angleSpeed = mEmitParticlesAngleSpeed + mRandom.Random(-halfAngleSpeedRange, halfAngleSpeedRange);
 
-				p->color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
-				p->color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
-				p->color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
-				p->color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
-				p->time = mParticlesLifetime;
-				p->alive = true;
+				p.color.r = mRandom.Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
+				p.color.g = mRandom.Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
+				p.color.b = mRandom.Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
+				p.color.a = mRandom.Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
+				p.time = mParticlesLifetime;
+				p.alive = true;
 
-				mNumAliveParticles++;
+				mParticles.Add(p);
 			}
 
 			mEmitTimeBuffer -= particlesDelay;
@@ -207,44 +199,28 @@ namespace o2
 
 	void ParticlesEmitter::UpdateParticles(float dt)
 	{
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-			{
-				idx++;
-				continue;
-			}
-
-			particle.position += particle.velocity*dt;
-			particle.angle += particle.angleSpeed*dt;
-			particle.time -= dt;
-
-			if (particle.time < 0)
-			{
-				particle.alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Integrate(dt);
+		mParticles.RemoveDead();
 	}
 
 	void ParticlesEmitter::UpdateMesh()
 	{
 		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
+		{
 			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+			mIndexedQuadsCount = 0;
+		}
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
+		if (mIndexedQuadsCount != mParticlesMesh->GetMaxPolyCount()/2)
+			UpdateMeshIndexes();
 
+		// Mesh is updated from worker threads, so texture is taken without TextureRef copy: copy changes texture
+		// references counter, that isn't thread safe. Texture size and image atlas rect are only read here
 		Vec2F invTexSize(1.0f, 1.0f);
-		if (mParticlesMesh->GetTexture())
+		if (Texture* texture = mParticlesMesh->GetTexturePtr())
 		{
-			invTexSize.Set(1.0f/mParticlesMesh->GetTexture()->GetSize().x,
-						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
+			Vec2I texSize = texture->GetSize();
+			invTexSize.Set(1.0f/texSize.x, 1.0f/texSize.y);
 		}
 
 		RectF textureSrcRect;
@@ -256,31 +232,28 @@ namespace o2
 		float uvUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
 		float uvDown = 1.0f - textureSrcRect.top*invTexSize.y;
 
-		for (auto& particle : mParticles)
+		mParticles.BuildQuads(mParticlesMesh->vertices, uvLeft, uvRight, uvUp, uvDown);
+
+		mParticlesMesh->vertexCount = mParticles.Count()*4;
+		mParticlesMesh->polyCount = mParticles.Count()*2;
+	}
+
+	void ParticlesEmitter::UpdateMeshIndexes()
+	{
+		mIndexedQuadsCount = mParticlesMesh->GetMaxPolyCount()/2;
+
+		UInt16* indexes = mParticlesMesh->indexes;
+		for (UInt i = 0; i < mIndexedQuadsCount; i++)
 		{
-			if (!particle.alive)
-				continue;
-
-			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
+			UInt16 vertex = (UInt16)(i*4);
+
+			*indexes++ = vertex;
+			*indexes++ = vertex + 1;
+			*indexes++ = vertex + 2;
+
+			*indexes++ = vertex;
+			*indexes++ = vertex + 2;
+			*indexes++ = vertex + 3;
 		}
 	}
 
@@ -290,8 +263,7 @@ namespace o2
 			return;
 
 		Basis change = mLastTransform.Inverted()*mTransform;
-		for (auto& particle : mParticles)
-			particle.position = change.Transform(particle.position);
+		mParticles.Transform(change);
 
 		mLastTransform = mTransform;
 	}
@@ -381,19 +353,7 @@ namespace o2
 	void ParticlesEmitter::SetMaxParticles(int count)
 	{
 		mParticlesNumLimit = count;
-
-		int idx = 0;
-		while (mNumAliveParticles > mParticlesNumLimit)
-		{
-			if (mParticles[idx].alive)
-			{
-				mParticles[idx].alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.Truncate(mParticlesNumLimit);
 	}
 
 	int ParticlesEmitter::GetMaxParticles() const
@@ -403,15 +363,15 @@ namespace o2
 
 	int ParticlesEmitter::GetParticlesCount() const
 	{
-		return mNumAliveParticles;
+		return mParticles.Count();
 	}
 
 	bool ParticlesEmitter::IsAliveParticles() const
 	{
-		return mNumAliveParticles > 0;
+		return !mParticles.IsEmpty();
 	}
 
-	const Vector<Particle>& ParticlesEmitter::GetParticles() const
+	const ParticlesBuffer& ParticlesEmitter::GetParticles() const
 	{
 		return mParticles;
 	}
@@ -597,6 +557,28 @@ namespace o2
 		mEmitParticlesColorA = colorA;
 		mEmitParticlesColorB = colorB;
 	}
+
+	void ParticlesEmitter::SetRandomSeed(UInt seed)
+	{
+		mRandomSeed = seed;
+		mRandom.SetSeed(seed);
+	}
+
+	UInt ParticlesEmitter::GetRandomSeed() const
+	{
+		return mRandomSeed;
+	}
+
+	void ParticlesEmitter::OnDeserialized(const DataValue& node)
+	{
+		mRandom.SetSeed(mRandomSeed);
+	}
+
+	UInt ParticlesEmitter::MakeRandomSeed(UInt sourceSeed /*= 0*/)
+	{
+		static std::atomic<UInt> seedsCounter(0);
+		return sourceSeed*0x9E3779B1u + ++seedsCounter;
+	}
 }
 
 DECLARE_CLASS(o2::ParticlesEmitter);
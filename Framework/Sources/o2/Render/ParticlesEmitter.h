@@ -2,10 +2,12 @@
 
 #include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesBuffer.h"
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Utils/Math/Curve.h"
+#include "o2/Utils/Math/RandomGenerator.h"
 
 namespace o2
 {
@@ -46,6 +48,7 @@ namespace o2
 
 		PROPERTY(ImageAssetRef, image, SetImage, GetImage);          // Particle image property
 		PROPERTY(ParticlesEmitterShape*, shape, SetShape, GetShape); // Emitting shape property @EDITOR_IGNORE
+		PROPERTY(UInt, randomSeed, SetRandomSeed, GetRandomSeed);    // Particles random generator seed property
 
 	public:
 		// Default constructor
@@ -124,8 +127,8 @@ namespace o2
 		// Returns has alive particles
 		bool IsAliveParticles() const;
 
-		// Returns particles list
-		const Vector<Particle>& GetParticles() const;
+		// Returns alive particles
+		const ParticlesBuffer& GetParticles() const;
 
 		// Sets particles relativity
 		void SetParticlesRelativity(bool relative);
@@ -235,6 +238,16 @@ namespace o2
 		// Sets emitting color A and B
 		void SetEmitParticlesColor(const Color4& colorA, const Color4& colorB);
 
+		// Sets particles random generator seed and restarts random sequence. Emitter with same seed and same
+		// updates emits same particles on any thread
+		void SetRandomSeed(UInt seed);
+
+		// Returns particles random generator seed
+		UInt GetRandomSeed() const;
+
+		// It is called when object was deserialized, restarts random sequence from deserialized seed
+		void OnDeserialized(const DataValue& node) override;
+
 	protected:
 		ImageAssetRef          mImageAsset;      // Particle sprite image @SERIALIZABLE
 		ParticlesEmitterShape* mShape = nullptr; // Particles emitting shape @SERIALIZABLE @EDITOR_PROPERTY 
@@ -270,13 +283,15 @@ namespace o2
 		Color4 mEmitParticlesColorA; // Emitting particles color A (particle emitting with color in range from this and ColorB)  @SERIALIZABLE
 		Color4 mEmitParticlesColorB; // Emitting particles color B (particle emitting with color in range from this and ColorA) @SERIALIZABLE
 
-		float            mCurrentTime = 0;         // Current working time in seconds
-		float            mEmitTimeBuffer = 0;      // Emitting next particle time buffer
-		Mesh*            mParticlesMesh = nullptr; // Particles mesh
-		Vector<Particle> mParticles;               // Working particles
-		Vector<int>      mDeadParticles;           // Dead particles indexes
-		int              mNumAliveParticles = 0;   // Count of current alive particles
-		Basis            mLastTransform;           // Last transformation
+		UInt            mRandomSeed = 0; // Particles random generator seed. Each new emitter and copy gets own seed @SERIALIZABLE
+		RandomGenerator mRandom;         // Particles random generator, emitter's own to not depend on other emitters and threads
+
+		float           mCurrentTime = 0;         // Current working time in seconds
+		float           mEmitTimeBuffer = 0;      // Emitting next particle time buffer
+		Mesh*           mParticlesMesh = nullptr; // Particles mesh
+		UInt            mIndexedQuadsCount = 0;   // Count of quads with initialized indexes in mesh
+		ParticlesBuffer mParticles;               // Alive particles
+		Basis           mLastTransform;           // Last transformation
 
 	protected:
 		// Emits particles hen updating
@@ -290,10 +305,17 @@ namespace o2
 
 		// Updates mesh geometry
 		void UpdateMesh(); 
+
+		// Fills mesh indexes for all quads. Particles quads are always same, so indexes are filled once after mesh resize
+		void UpdateMeshIndexes();
 		
 		// It is called when basis was changed, updates particles positions from last transform
 		void BasisChanged();
 
+		// Returns new random seed. Seeds are made from counter of created emitters mixed with source emitter seed,
+		// so copies of one emitter get different seeds, and same creation order gives same seeds each run
+		static UInt MakeRandomSeed(UInt sourceSeed = 0);
+
 		friend class ParticlesEffect;
 	};
 
@@ -333,6 +355,7 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	PUBLIC_FIELD(emitParticlesColorB);
 	PUBLIC_FIELD(image);
 	PUBLIC_FIELD(shape).EDITOR_IGNORE_ATTRIBUTE();
+	PUBLIC_FIELD(randomSeed);
 	PROTECTED_FIELD(mImageAsset).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mShape).DEFAULT_VALUE(nullptr).EDITOR_PROPERTY_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mEffects).EDITOR_PROPERTY_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE();
@@ -356,12 +379,13 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	PROTECTED_FIELD(mEmitParticlesAngleSpeedRange).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mEmitParticlesColorA).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mEmitParticlesColorB).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mRandomSeed).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mRandom);
 	PROTECTED_FIELD(mCurrentTime).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mEmitTimeBuffer).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mParticlesMesh).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mIndexedQuadsCount).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mParticles);
-	PROTECTED_FIELD(mDeadParticles);
-	PROTECTED_FIELD(mNumAliveParticles).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mLastTransform);
 }
 END_META;
@@ -388,7 +412,7 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(int, GetMaxParticles);
 	PUBLIC_FUNCTION(int, GetParticlesCount);
 	PUBLIC_FUNCTION(bool, IsAliveParticles);
-	PUBLIC_FUNCTION(const Vector<Particle>&, GetParticles);
+	PUBLIC_FUNCTION(const ParticlesBuffer&, GetParticles);
 	PUBLIC_FUNCTION(void, SetParticlesRelativity, bool);
 	PUBLIC_FUNCTION(bool, IsParticlesRelative);
 	PUBLIC_FUNCTION(void, SetLoop, bool);
@@ -425,10 +449,15 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(Color4, GetEmitParticlesColorB);
 	PUBLIC_FUNCTION(void, SetEmitParticlesColor, const Color4&);
 	PUBLIC_FUNCTION(void, SetEmitParticlesColor, const Color4&, const Color4&);
+	PUBLIC_FUNCTION(void, SetRandomSeed, UInt);
+	PUBLIC_FUNCTION(UInt, GetRandomSeed);
+	PUBLIC_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, UpdateEmitting, float);
 	PROTECTED_FUNCTION(void, UpdateEffects, float);
 	PROTECTED_FUNCTION(void, UpdateParticles, float);
 	PROTECTED_FUNCTION(void, UpdateMesh);
+	PROTECTED_FUNCTION(void, UpdateMeshIndexes);
 	PROTECTED_FUNCTION(void, BasisChanged);
+	PROTECTED_STATIC_FUNCTION(UInt, MakeRandomSeed, UInt);
 }
 END_META;
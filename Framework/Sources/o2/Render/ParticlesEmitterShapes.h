@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Utils/Math/RandomGenerator.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
@@ -13,7 +14,9 @@ namespace o2
 
 	public:
 		virtual ~ParticlesEmitterShape() {}
-		virtual Vec2F GetEmittinPoint();
+
+		// Returns random emitting point, random values are taken from emitter's generator
+		virtual Vec2F GetEmittinPoint(RandomGenerator& random);
 	};
 
 	// ---------------------------------
@@ -26,7 +29,7 @@ namespace o2
 	public:
 		float radius = 0;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(RandomGenerator& random);
 	};
 
 	// ---------------------------------
@@ -39,7 +42,7 @@ namespace o2
 	public:
 		Vec2F size;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(RandomGenerator& random);
 	};
 }
 
@@ -55,7 +58,7 @@ END_META;
 CLASS_METHODS_META(o2::ParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
 
@@ -72,7 +75,7 @@ END_META;
 CLASS_METHODS_META(o2::CircleParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
 
@@ -89,6 +92,6 @@ END_META;
 CLASS_METHODS_META(o2::SquareParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, RandomGenerator&);
 }
 END_META;
@@ -557,6 +557,75 @@ namespace o2
 				   mesh->indexes, mesh->polyCount, mesh->mTexture);
 	}
 
+	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (!mReady)
+			return;
+
+		mDrawingDepth += 1.0f;
+
+		if (mClippingEverything)
+			return;
+
+		if (mRenderQueueEnabled && !mRenderQueueFlushing)
+		{
+			mRenderQueue.Add(mRenderQueueLayer, mDrawingDepth, primitiveType, vertices, verticesCount, indexes,
+							 elementsCount, texture);
+			return;
+		}
+
+		DrawBufferImmediate(primitiveType, vertices, verticesCount, indexes, elementsCount, texture);
+	}
+
+	void Render::EnableRenderQueue()
+	{
+		mRenderQueueEnabled = true;
+	}
+
+	void Render::DisableRenderQueue()
+	{
+		FlushRenderQueue();
+		mRenderQueueEnabled = false;
+	}
+
+	bool Render::IsRenderQueueEnabled() const
+	{
+		return mRenderQueueEnabled;
+	}
+
+	void Render::SetRenderQueueLayer(int layer)
+	{
+		mRenderQueueLayer = layer;
+	}
+
+	int Render::GetRenderQueueLayer() const
+	{
+		return mRenderQueueLayer;
+	}
+
+	RenderQueue& Render::GetRenderQueue()
+	{
+		return mRenderQueue;
+	}
+
+	void Render::FlushRenderQueue()
+	{
+		if (mRenderQueueFlushing || mRenderQueue.IsEmpty())
+			return;
+
+		mRenderQueueFlushing = true;
+
+		for (auto command : mRenderQueue.Build())
+		{
+			DrawBufferImmediate(command->primitiveType, mRenderQueue.GetVertices(*command), command->verticesCount,
+								mRenderQueue.GetIndexes(*command), command->elementsCount, command->texture);
+		}
+
+		mRenderQueue.Clear();
+		mRenderQueueFlushing = false;
+	}
+
 	void Render::DrawMeshWire(Mesh* mesh, const Color4& color /*= Color4::White()*/)
 	{
 		auto dcolor = color.ABGR();
@@ -626,6 +695,11 @@ namespace o2
 		return mMaxTextureSize;
 	}
 
+	const Vector<Texture*>& Render::GetTextures() const
+	{
+		return mTextures;
+	}
+
 	float Render::GetDrawingDepth()
 	{
 		mDrawingDepth += 1.0f;
@@ -5,11 +5,14 @@
 
 #if defined PLATFORM_WINDOWS
 #include "o2/Render/Windows/RenderBase.h"
+#elif defined PLATFORM_LINUX
+#include "o2/Render/Linux/RenderBase.h"
 #elif defined PLATFORM_ANDROID
 #include "o2/Render/Android/RenderBase.h"
 #endif
 
 #include "o2/Render/Camera.h"
+#include "o2/Render/RenderQueue.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Vertex2.h"
 #include "o2/Utils/Singleton.h"
@@ -243,6 +246,28 @@ namespace o2
 		void DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
 						UInt16* indexes, UInt elementsCount, const TextureRef& texture);
 
+		// Enables deferred render queue mode. Drawing commands are collecting, sorting by layer and depth and
+		// merging by texture and primitive type until any render state change or frame end
+		void EnableRenderQueue();
+
+		// Disables deferred render queue mode and draws collected commands
+		void DisableRenderQueue();
+
+		// Returns true when deferred render queue mode is enabled
+		bool IsRenderQueueEnabled() const;
+
+		// Sets render queue layer for next drawing commands. Commands with lower layer are drawing first
+		void SetRenderQueueLayer(int layer);
+
+		// Returns render queue layer for next drawing commands
+		int GetRenderQueueLayer() const;
+
+		// Returns render queue
+		RenderQueue& GetRenderQueue();
+
+		// Sorts, batches and draws collected render queue commands
+		void FlushRenderQueue();
+
 		// Draws mesh wire
 		void DrawMeshWire(Mesh* mesh, const Color4& color = Color4::White());
 
@@ -268,6 +293,9 @@ namespace o2
 		// Returns maximum texture size
 		Vec2I GetMaxTextureSize() const;
 
+		// Returns loaded textures
+		const Vector<Texture*>& GetTextures() const;
+
 		// Returns last draw depth of mesh
 		float GetDrawingDepth();
 
@@ -318,6 +346,11 @@ namespace o2
 		TextureRef mSolidLineTexture;   // Solid line texture
 		TextureRef mDashLineTexture;    // Dash line texture
 
+		RenderQueue mRenderQueue;                 // Deferred drawing commands queue
+		bool        mRenderQueueEnabled = false;  // True, when drawing commands are collecting in render queue
+		bool        mRenderQueueFlushing = false; // True, when render queue commands are drawing
+		int         mRenderQueueLayer = 0;        // Render queue layer for next drawing commands
+
 		bool mReady; // True, if render system initialized
 
 	protected:
@@ -345,6 +378,10 @@ namespace o2
 		// Send buffers to draw
 		void DrawPrimitives();
 
+		// Puts data to buffers or sends them to draw when state changes, without render queue
+		void DrawBufferImmediate(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+								 UInt16* indexes, UInt elementsCount, const TextureRef& texture);
+
 		// Sets orthographic view matrix by view size
 		void SetupViewMatrix(const Vec2I& viewSize);
 
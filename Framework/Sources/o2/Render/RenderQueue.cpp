@@ -0,0 +1,167 @@
+#include "o2/stdafx.h"
+#include "RenderQueue.h"
+
+namespace o2
+{
+	RenderQueue::RenderQueue()
+	{}
+
+	void RenderQueue::Add(int layer, float depth, PrimitiveType primitiveType, const Vertex2* vertices, UInt verticesCount,
+						  const UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	{
+		if (verticesCount == 0)
+			return;
+
+		UInt indexesCount;
+		if (primitiveType == PrimitiveType::Line)
+			indexesCount = elementsCount*2;
+		else
+			indexesCount = elementsCount*3;
+
+		if (!mCommands.IsEmpty() && mCommands.Last().layer != layer)
+			mLayersDiffer = true;
+
+		Command command;
+		command.layer = layer;
+		command.depth = depth;
+		command.texture = texture;
+		command.primitiveType = primitiveType;
+		command.verticesOffset = mVertices.Count();
+		command.verticesCount = verticesCount;
+		command.indexesOffset = mIndexes.Count();
+		command.indexesCount = indexesCount;
+		command.elementsCount = elementsCount;
+
+		float minX = vertices[0].x, maxX = vertices[0].x, minY = vertices[0].y, maxY = vertices[0].y;
+		for (UInt i = 1; i < verticesCount; i++)
+		{
+			const Vertex2& v = vertices[i];
+			minX = Math::Min(minX, v.x); maxX = Math::Max(maxX, v.x);
+			minY = Math::Min(minY, v.y); maxY = Math::Max(maxY, v.y);
+		}
+
+		command.bounds.Set(minX, maxY, maxX, minY);
+
+		mVertices.insert(mVertices.end(), vertices, vertices + verticesCount);
+		mIndexes.insert(mIndexes.end(), indexes, indexes + indexesCount);
+
+		mCommands.Add(command);
+	}
+
+	const Vector<RenderQueue::Command*>& RenderQueue::Build()
+	{
+		mSortedCommands.Clear();
+		mBatches.Clear();
+
+		for (auto& command : mCommands)
+		{
+			command.nextInBatch = nullptr;
+			mSortedCommands.Add(&command);
+		}
+
+		// Commands are already ordered by depth, because depth grows with each submission.
+		// Only layers can break the order
+		if (mLayersDiffer)
+		{
+			std::stable_sort(mSortedCommands.begin(), mSortedCommands.end(), [](const Command* a, const Command* b)
+			{
+				if (a->layer != b->layer)
+					return a->layer < b->layer;
+
+				return a->depth < b->depth;
+			});
+		}
+
+		// Search batch with same state for each command. Command can be moved back to that batch only if it 
+		// doesn't overlap any batch drawn after that, so resulting image doesn't change
+		for (auto command : mSortedCommands)
+		{
+			Batch* targetBatch = nullptr;
+			int lookbackLimit = Math::Max(0, mBatches.Count() - mMaxBatchLookback);
+			for (int i = mBatches.Count() - 1; i >= lookbackLimit; i--)
+			{
+				Batch& batch = mBatches[i];
+				if (batch.first->layer != command->layer)
+					break;
+
+				if (batch.first->IsSameState(*command))
+				{
+					targetBatch = &batch;
+					break;
+				}
+
+				if (batch.bounds.IsIntersects(command->bounds))
+					break;
+			}
+
+			if (targetBatch)
+			{
+				targetBatch->last->nextInBatch = command;
+				targetBatch->last = command;
+				targetBatch->bounds = targetBatch->bounds.Expand(command->bounds);
+			}
+			else
+			{
+				Batch batch;
+				batch.first = command;
+				batch.last = command;
+				batch.bounds = command->bounds;
+				mBatches.Add(batch);
+			}
+		}
+
+		mSortedCommands.Clear();
+		for (auto& batch : mBatches)
+		{
+			for (Command* command = batch.first; command; command = command->nextInBatch)
+				mSortedCommands.Add(command);
+		}
+
+		return mSortedCommands;
+	}
+
+	Vertex2* RenderQueue::GetVertices(const Command& command)
+	{
+		return mVertices.Data() + command.verticesOffset;
+	}
+
+	UInt16* RenderQueue::GetIndexes(const Command& command)
+	{
+		return mIndexes.Data() + command.indexesOffset;
+	}
+
+	void RenderQueue::Clear()
+	{
+		mCommands.Clear();
+		mVertices.Clear();
+		mIndexes.Clear();
+		mSortedCommands.Clear();
+		mBatches.Clear();
+		mLayersDiffer = false;
+	}
+
+	bool RenderQueue::IsEmpty() const
+	{
+		return mCommands.IsEmpty();
+	}
+
+	int RenderQueue::GetCommandsCount() const
+	{
+		return mCommands.Count();
+	}
+
+	void RenderQueue::SetMaxBatchLookback(int count)
+	{
+		mMaxBatchLookback = Math::Max(1, count);
+	}
+
+	int RenderQueue::GetMaxBatchLookback() const
+	{
+		return mMaxBatchLookback;
+	}
+
+	bool RenderQueue::Command::IsSameState(const Command& other) const
+	{
+		return texture == other.texture && primitiveType == other.primitiveType;
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vertex2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------
+	// Deferred render queue. Collects drawing commands keyed by layer, depth, texture and primitive type,
+	// sorts them stably by layer and depth and merges commands with same texture and primitive type,
+	// moving them through neighbours they don't overlap. Result is a sequence of commands, where
+	// commands with same state are placed together, so render can draw them with minimal DIPs count
+	// -------------------------------------------------------------------------------------------------
+	class RenderQueue
+	{
+	public:
+		// ---------------------
+		// Queued drawing command
+		// ---------------------
+		struct Command
+		{
+			int           layer = 0;                             // Sorting layer, commands with lower layer are drawing first
+			float         depth = 0.0f;                          // Drawing depth at submission
+			TextureRef    texture;                               // Drawing texture
+			PrimitiveType primitiveType = PrimitiveType::Polygon; // Type of drawing primitives
+
+			UInt verticesOffset = 0; // Offset of first vertex in queue vertices buffer
+			UInt verticesCount = 0;  // Count of vertices
+			UInt indexesOffset = 0;  // Offset of first index in queue indexes buffer
+			UInt indexesCount = 0;   // Count of indexes
+			UInt elementsCount = 0;  // Count of primitives
+
+			RectF bounds; // Vertices bounding rectangle
+
+			Command* nextInBatch = nullptr; // Next command in same batch, used when building queue
+
+		public:
+			// Returns true when commands can be drawn in one DIP
+			bool IsSameState(const Command& other) const;
+		};
+
+	public:
+		// Constructor
+		RenderQueue();
+
+		// Adds drawing command. Copies vertices and indexes into queue buffers
+		void Add(int layer, float depth, PrimitiveType primitiveType, const Vertex2* vertices, UInt verticesCount,
+				 const UInt16* indexes, UInt elementsCount, const TextureRef& texture);
+
+		// Sorts and batches commands. Returns commands in drawing order
+		const Vector<Command*>& Build();
+
+		// Returns vertices buffer of command
+		Vertex2* GetVertices(const Command& command);
+
+		// Returns indexes buffer of command
+		UInt16* GetIndexes(const Command& command);
+
+		// Removes all commands
+		void Clear();
+
+		// Returns true when there is no commands in queue
+		bool IsEmpty() const;
+
+		// Returns commands count
+		int GetCommandsCount() const;
+
+		// Sets maximum count of batches, checked when searching batch for merging command
+		void SetMaxBatchLookback(int count);
+
+		// Returns maximum count of batches, checked when searching batch for merging command
+		int GetMaxBatchLookback() const;
+
+	protected:
+		// ----------------------------------------------------
+		// Batch of commands with same state, drawing together
+		// ----------------------------------------------------
+		struct Batch
+		{
+			Command* first = nullptr; // First command in batch, contains batch state
+			Command* last = nullptr;  // Last command in batch
+			RectF    bounds;          // Summary bounds of batch commands
+		};
+
+	protected:
+		Vector<Command> mCommands; // Submitted commands
+		Vector<Vertex2> mVertices; // Vertices of all commands
+		Vector<UInt16>  mIndexes;  // Indexes of all commands
+
+		Vector<Command*> mSortedCommands; // Sorted and batched commands, result of Build()
+		Vector<Batch>    mBatches;        // Batches buffer, used in Build()
+
+		bool mLayersDiffer = false; // True when commands have different layers and must be sorted
+
+		int mMaxBatchLookback = 64; // Maximum count of batches checked when merging command
+	};
+}
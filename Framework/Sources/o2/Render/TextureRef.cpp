@@ -36,6 +36,19 @@ namespace o2
 		mTexture->mRefs++;
 	}
 
+	TextureRef::TextureRef(const String& fileName, Bitmap* bitmap)
+	{
+		mTexture = o2Render.mTextures.FindOrDefault([&](Texture* tex) { return tex->GetFileName() == fileName; });
+
+		if (!mTexture)
+		{
+			mTexture = mnew Texture(bitmap);
+			mTexture->mFileName = fileName;
+		}
+
+		mTexture->mRefs++;
+	}
+
 	TextureRef::TextureRef(const TextureRef& other):
 		mTexture(other.mTexture)
 	{
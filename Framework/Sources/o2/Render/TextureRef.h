@@ -24,6 +24,10 @@ namespace o2
 		// Constructor from bitmap
 		TextureRef(Bitmap* bitmap);
 
+		// Constructor from file with already loaded file bitmap. Bitmap is uploaded only when texture with this file
+		// name isn't loaded yet
+		TextureRef(const String& fileName, Bitmap* bitmap);
+
 		// Constructor from atlas page
 		TextureRef(UID atlasAssetId, int page);
 
@@ -22,6 +22,12 @@ void GetGLExtensions(o2::LogStream* log /*= nullptr*/)
 	glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)GetSafeWGLProcAddress("glFramebufferTexture", log);
 	glDrawBuffers = (PFNGLDRAWBUFFERSPROC)GetSafeWGLProcAddress("glDrawBuffers", log);
 	glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteBuffers", log);
+	glGenBuffers = (PFNGLGENBUFFERSPROC)GetSafeWGLProcAddress("glGenBuffers", log);
+	glBindBuffer = (PFNGLBINDBUFFERPROC)GetSafeWGLProcAddress("glBindBuffer", log);
+	glBufferData = (PFNGLBUFFERDATAPROC)GetSafeWGLProcAddress("glBufferData", log);
+	glBufferSubData = (PFNGLBUFFERSUBDATAPROC)GetSafeWGLProcAddress("glBufferSubData", log);
+	glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)GetSafeWGLProcAddress("glMapBufferRange", log);
+	glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)GetSafeWGLProcAddress("glUnmapBuffer", log);
 	glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteFramebuffersEXT", log);
 	glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)GetSafeWGLProcAddress("glCheckFramebufferStatusEXT", log);
 
@@ -95,6 +101,12 @@ extern PFNGLBINDFRAMEBUFFEREXTPROC        glBindFramebufferEXT = NULL;
 extern PFNGLFRAMEBUFFERTEXTUREPROC        glFramebufferTexture = NULL;
 extern PFNGLDRAWBUFFERSPROC               glDrawBuffers = NULL;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers = NULL;
+extern PFNGLGENBUFFERSPROC                glGenBuffers = NULL;
+extern PFNGLBINDBUFFERPROC                glBindBuffer = NULL;
+extern PFNGLBUFFERDATAPROC                glBufferData = NULL;
+extern PFNGLBUFFERSUBDATAPROC             glBufferSubData = NULL;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange = NULL;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer = NULL;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT = NULL;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT = NULL;
 
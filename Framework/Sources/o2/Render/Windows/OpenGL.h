@@ -37,6 +37,12 @@ extern PFNGLBINDFRAMEBUFFEREXTPROC        glBindFramebufferEXT;
 extern PFNGLFRAMEBUFFERTEXTUREPROC        glFramebufferTexture;
 extern PFNGLDRAWBUFFERSPROC               glDrawBuffers;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers;
+extern PFNGLGENBUFFERSPROC                glGenBuffers;
+extern PFNGLBINDBUFFERPROC                glBindBuffer;
+extern PFNGLBUFFERDATAPROC                glBufferData;
+extern PFNGLBUFFERSUBDATAPROC             glBufferSubData;
+extern PFNGLMAPBUFFERRANGEPROC            glMapBufferRange;
+extern PFNGLUNMAPBUFFERPROC               glUnmapBuffer;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
 
@@ -21,6 +21,31 @@ namespace o2
 		UInt16* mVertexIndexData;          // Index data buffer
 		UInt    mVertexBufferSize = 6000;  // Maximum size of vertex buffer
 		UInt    mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		bool   mBufferObjectsEnabled = false;   // True, when vertices are streaming through GPU buffer objects
+		bool   mBufferObjectsMapping = false;   // True, when buffer objects are filling by mapping, otherwise by sub data
+		GLuint mVertexBufferObject = 0;         // GPU vertices ring buffer
+		GLuint mIndexBufferObject = 0;          // GPU indexes ring buffer
+		UInt   mVertexRingBufferSize = 0;       // Size of vertices ring buffer in bytes
+		UInt   mIndexRingBufferSize = 0;        // Size of indexes ring buffer in bytes
+		UInt   mVertexRingBufferOffset = 0;     // Current writing offset in vertices ring buffer in bytes
+		UInt   mIndexRingBufferOffset = 0;      // Current writing offset in indexes ring buffer in bytes
+
+	protected:
+		// Creates vertex and index ring buffer objects. Returns false when buffer objects are not supported
+		bool InitializeBufferObjects();
+
+		// Deletes vertex and index ring buffer objects
+		void DeinitializeBufferObjects();
+
+		// Orphans buffer objects storages and resets ring offsets, so driver can give new storages without sync
+		void OrphanBufferObjects();
+
+		// Writes data into ring buffer bound at target
+		void UploadBufferObjectData(GLenum target, UInt offset, UInt size, const void* data);
+
+		// Sets vertex, color and texture coordinates pointers for vertices starting at base
+		void SetupVertexPointers(const UInt8* base);
 	};
 };
 
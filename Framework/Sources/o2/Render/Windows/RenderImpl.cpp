@@ -6,6 +6,7 @@
 #include "o2/Application/Application.h"
 #include "o2/Application/Input.h"
 #include "o2/Assets/Assets.h"
+#include "o2/EngineSettings.h"
 #include "o2/Events/EventSystem.h"
 #include "o2/Render/Font.h"
 #include "o2/Render/Mesh.h"
@@ -13,6 +14,7 @@
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
 
@@ -110,9 +112,10 @@ namespace o2
 		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
 		glEnableClientState(GL_VERTEX_ARRAY);
 
-		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), mVertexData + sizeof(float) * 3);
-		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), mVertexData + sizeof(float) * 3 + sizeof(unsigned long));
-		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), mVertexData + 0);
+		if (IsRenderBufferObjectsEnabled() && InitializeBufferObjects())
+			mLog->Out("Using vertex buffer objects ring: " + (String)mVertexRingBufferSize + " bytes");
+		else
+			SetupVertexPointers(mVertexData);
 
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -155,6 +158,8 @@ namespace o2
 
 		if (mGLContext)
 		{
+			DeinitializeBufferObjects();
+
 			auto fonts = mFonts;
 			for (auto font : fonts)
 				delete font;
@@ -224,12 +229,38 @@ namespace o2
 
 	void Render::DrawPrimitives()
 	{
+		PROFILE_SCOPE("Render::DrawPrimitives");
+
+		FlushRenderQueue();
+
 		if (mLastDrawVertex < 1)
 			return;
 
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
-		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
+		if (mBufferObjectsEnabled)
+		{
+			UInt verticesSize = mLastDrawVertex*sizeof(Vertex2);
+			UInt indexesSize = mLastDrawIdx*sizeof(UInt16);
+
+			if (mVertexRingBufferOffset + verticesSize > mVertexRingBufferSize ||
+				mIndexRingBufferOffset + indexesSize > mIndexRingBufferSize)
+			{
+				OrphanBufferObjects();
+			}
+
+			UploadBufferObjectData(GL_ARRAY_BUFFER, mVertexRingBufferOffset, verticesSize, mVertexData);
+			UploadBufferObjectData(GL_ELEMENT_ARRAY_BUFFER, mIndexRingBufferOffset, indexesSize, mVertexIndexData);
+
+			SetupVertexPointers((const UInt8*)nullptr + mVertexRingBufferOffset);
+			glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT,
+						   (const UInt8*)nullptr + mIndexRingBufferOffset);
+
+			mVertexRingBufferOffset += verticesSize;
+			mIndexRingBufferOffset += (indexesSize + 3) & ~3;
+		}
+		else
+			glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
 
 		GL_CHECK_ERROR();
 
@@ -239,6 +270,84 @@ namespace o2
 		mDIPCount++;
 	}
 
+	bool RenderBase::InitializeBufferObjects()
+	{
+		if (!glGenBuffers || !glBindBuffer || !glBufferData || !glBufferSubData || !glDeleteBuffers)
+			return false;
+
+		mVertexRingBufferSize = Math::Max(GetRenderVertexRingBufferSize(), mVertexBufferSize)*sizeof(Vertex2);
+		mIndexRingBufferSize = Math::Max(GetRenderIndexRingBufferSize(), mIndexBufferSize)*sizeof(UInt16);
+		mBufferObjectsMapping = glMapBufferRange && glUnmapBuffer;
+
+		glGenBuffers(1, &mVertexBufferObject);
+		glGenBuffers(1, &mIndexBufferObject);
+
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObject);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferObject);
+
+		OrphanBufferObjects();
+
+		if (glGetError() != GL_NO_ERROR)
+		{
+			DeinitializeBufferObjects();
+			return false;
+		}
+
+		mBufferObjectsEnabled = true;
+		return true;
+	}
+
+	void RenderBase::DeinitializeBufferObjects()
+	{
+		if (mVertexBufferObject == 0 && mIndexBufferObject == 0)
+			return;
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+		glDeleteBuffers(1, &mVertexBufferObject);
+		glDeleteBuffers(1, &mIndexBufferObject);
+
+		mVertexBufferObject = 0;
+		mIndexBufferObject = 0;
+		mBufferObjectsEnabled = false;
+	}
+
+	void RenderBase::OrphanBufferObjects()
+	{
+		glBufferData(GL_ARRAY_BUFFER, mVertexRingBufferSize, nullptr, GL_STREAM_DRAW);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexRingBufferSize, nullptr, GL_STREAM_DRAW);
+
+		mVertexRingBufferOffset = 0;
+		mIndexRingBufferOffset = 0;
+	}
+
+	void RenderBase::UploadBufferObjectData(GLenum target, UInt offset, UInt size, const void* data)
+	{
+		if (mBufferObjectsMapping)
+		{
+			// Ring region after offset isn't used by any queued draw call, because buffer is orphaned on wrapping
+			void* dst = glMapBufferRange(target, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+										 GL_MAP_UNSYNCHRONIZED_BIT);
+
+			if (dst)
+			{
+				memcpy(dst, data, size);
+				glUnmapBuffer(target);
+				return;
+			}
+		}
+
+		glBufferSubData(target, offset, size, data);
+	}
+
+	void RenderBase::SetupVertexPointers(const UInt8* base)
+	{
+		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex2), base + sizeof(float)*3);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex2), base + sizeof(float)*3 + sizeof(unsigned long));
+		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), base + 0);
+	}
+
 	void Render::SetupViewMatrix(const Vec2I& viewSize)
 	{
 		mCurrentResolution = viewSize;
@@ -473,17 +582,9 @@ namespace o2
 		}
 	}
 
-	void Render::DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
-							UInt16* indexes, UInt elementsCount, const TextureRef& texture)
+	void Render::DrawBufferImmediate(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
+									 UInt16* indexes, UInt elementsCount, const TextureRef& texture)
 	{
-		if (!mReady)
-			return;
-
-		mDrawingDepth += 1.0f;
-
-		if (mClippingEverything)
-			return;
-
 		UInt indexesCount;
 		if (primitiveType == PrimitiveType::Line)
 			indexesCount = elementsCount * 2;
@@ -289,8 +289,17 @@ namespace o2
 
 		OnUpdate(dt);
 
+		// Thread safe components are collected by scene and updated in parallel after all actors
+		bool collectThreadSafe = mSceneStatus == SceneStatus::InScene && Scene::IsSingletonInitialzed() &&
+			o2Scene.mCollectingParallelComponents;
+
 		for (auto comp : mComponents)
-			comp->Update(dt);
+		{
+			if (collectThreadSafe && comp->IsUpdateThreadSafe())
+				o2Scene.mParallelUpdateComponents.Add(comp);
+			else
+				comp->Update(dt);
+		}
 	}
 
 	void Actor::FixedUpdate(float dt)
@@ -548,6 +557,9 @@ namespace o2
 		else if (IsOnScene() && Scene::IsSingletonInitialzed())
 			o2Scene.mRootActors.Add(this);
 
+		if (IsOnScene() && Scene::IsSingletonInitialzed())
+			o2Scene.OnActorsHierarchyChanged();
+
 		if (worldPositionStays)
 			transform->SetWorldBasis(lastParentBasis);
 		else
@@ -652,6 +664,9 @@ namespace o2
 		actor->mParent = nullptr;
 		mChildren.Remove(actor);
 
+		if (Scene::IsSingletonInitialzed())
+			o2Scene.OnActorsHierarchyChanged();
+
 		actor->OnParentChanged(oldParent);
 		OnChildRemoved(actor);
 		OnChildrenChanged();
@@ -842,7 +857,12 @@ namespace o2
 		}
 
 		for (auto comp : mComponents)
+		{
+			if (Scene::IsSingletonInitialzed())
+				o2Scene.RegComponent(comp);
+
 			comp->OnAddToScene();
+		}
 	}
 
 	void Actor::OnRemoveFromScene()
@@ -856,7 +876,12 @@ namespace o2
 		}
 
 		for (auto comp : mComponents)
+		{
+			if (Scene::IsSingletonInitialzed())
+				o2Scene.UnregComponent(comp);
+
 			comp->OnRemoveFromScene();
+		}
 	}
 
 	void Actor::OnStart()
@@ -897,7 +922,10 @@ namespace o2
 		if (mSceneStatus == SceneStatus::InScene)
 		{
 			if (Scene::IsSingletonInitialzed())
+			{
 				o2Scene.OnComponentAdded(component);
+				o2Scene.RegComponent(component);
+			}
 
 			component->OnAddToScene();
 		}
@@ -911,7 +939,10 @@ namespace o2
 		if (IsOnScene())
 		{
 			if (Scene::IsSingletonInitialzed())
+			{
 				o2Scene.OnComponentRemoved(component);
+				o2Scene.UnregComponent(component);
+			}
 
 			component->OnRemoveFromScene();
 		}
@@ -634,6 +634,7 @@ namespace o2
 		friend class Scene;
 		friend class SceneLayer;
 		friend class Tag;
+		friend class TransformHierarchyStore;
 		friend class Widget;
 	};
 }
@@ -685,7 +686,7 @@ namespace o2
 	template<typename _type>
 	_type* Actor::GetComponentInChildren() const
 	{
-		_type* res = GetComponent<_type*>();
+		_type* res = GetComponent<_type>();
 
 		if (res)
 			return res;
@@ -705,8 +706,8 @@ namespace o2
 	{
 		for (auto comp : mComponents)
 		{
-			if (comp->GetType().IsBasedOn(TypeOf(_type)))
-				return dynamic_cast<_type*>(comp);
+			if (_type* res = Reflection::Cast<_type>(comp))
+				return res;
 		}
 
 		return nullptr;
@@ -718,8 +719,8 @@ namespace o2
 		Vector<_type*> res;
 		for (auto comp : mComponents)
 		{
-			if (comp->GetType().IsBasedOn(TypeOf(_type)))
-				res.Add(comp);
+			if (_type* casted = Reflection::Cast<_type>(comp))
+				res.Add(casted);
 		}
 
 		return res;
@@ -140,6 +140,7 @@ namespace o2
 
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::Actor>);
 
 DECLARE_CLASS(o2::ActorRef);
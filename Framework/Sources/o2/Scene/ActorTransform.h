@@ -454,6 +454,7 @@ namespace o2
 		Vec2F GetParentPosition() const;
 
 		friend class Actor;
+		friend class TransformHierarchyStore;
 		friend class WidgetLayout;
 	};
 
@@ -40,12 +40,32 @@ namespace o2
 			o2Render.Clear(fillColor);
 
 		Camera prevCamera = o2Render.GetCamera();
-		Setup();
+		Camera camera = GetRenderCamera();
+		o2Render.SetCamera(camera);
+
+		RectF cameraRect = camera.GetBasis().AABB();
+
+		mDrawnDrawablesCount = 0;
+		mCulledDrawablesCount = 0;
 
 		for (auto layer : drawLayers.GetLayers())
 		{
-			for (auto comp : layer->mEnabledDrawables)
-				comp->Draw();
+			if (!culling)
+			{
+				for (auto drawable : layer->GetEnabledDrawables())
+					drawable->Draw();
+
+				mDrawnDrawablesCount += layer->GetEnabledDrawables().Count();
+				continue;
+			}
+
+			// Visible drawables are taken from layer spatial index, so culling cost depends on visible drawables count
+			auto visibleDrawables = layer->FindDrawables(cameraRect);
+			for (auto drawable : visibleDrawables)
+				drawable->Draw();
+
+			mDrawnDrawablesCount += visibleDrawables.Count();
+			mCulledDrawablesCount += layer->GetEnabledDrawables().Count() - visibleDrawables.Count();
 		}
 
 		o2Render.SetCamera(prevCamera);
@@ -111,6 +131,16 @@ namespace o2
 		return mUnits;
 	}
 
+	int CameraActor::GetDrawnDrawablesCount() const
+	{
+		return mDrawnDrawablesCount;
+	}
+
+	int CameraActor::GetCulledDrawablesCount() const
+	{
+		return mCulledDrawablesCount;
+	}
+
 	void CameraActor::OnAddToScene()
 	{
 		o2Scene.OnCameraAddedOnScene(this);
@@ -18,6 +18,8 @@ namespace o2
 		bool   fillBackground = true;       // Is background filling with solid color @SERIALIZABLE
 		Color4 fillColor = Color4::White(); // Background fill color @SERIALIZABLE
 
+		bool culling = true; // Is drawables outside camera rectangle skipping @SERIALIZABLE
+
 	public:
 		// Default constructor
 		CameraActor();
@@ -61,6 +63,12 @@ namespace o2
 		// Returns current camera units
 		Units GetUnits() const;
 
+		// Returns count of drawn drawables at last drawing
+		int GetDrawnDrawablesCount() const;
+
+		// Returns count of drawables culled by camera rectangle at last drawing
+		int GetCulledDrawablesCount() const;
+
 		SERIALIZABLE(CameraActor);
 
 	protected:
@@ -68,6 +76,9 @@ namespace o2
 		Vec2F mFixedOrFittedSize;          // Fitted or fixed types size @SERIALIZABLE
 		Units mUnits = Units::Centimeters; // Physical camera units @SERIALIZABLE
 
+		int mDrawnDrawablesCount = 0;  // Count of drawn drawables at last drawing
+		int mCulledDrawablesCount = 0; // Count of drawables culled by camera rectangle at last drawing
+
 	protected:
 		// Is is called when actor has added to scene
 		void OnAddToScene() override;
@@ -89,9 +100,12 @@ CLASS_FIELDS_META(o2::CameraActor)
 	PUBLIC_FIELD(drawLayers).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(fillBackground).DEFAULT_VALUE(true).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(fillColor).DEFAULT_VALUE(Color4::White()).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(culling).DEFAULT_VALUE(true).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mType).DEFAULT_VALUE(Type::Default).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mFixedOrFittedSize).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mUnits).DEFAULT_VALUE(Units::Centimeters).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mDrawnDrawablesCount).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mCulledDrawablesCount).DEFAULT_VALUE(0);
 }
 END_META;
 CLASS_METHODS_META(o2::CameraActor)
@@ -107,6 +121,8 @@ CLASS_METHODS_META(o2::CameraActor)
 	PUBLIC_FUNCTION(Type, GetCameraType);
 	PUBLIC_FUNCTION(const Vec2F&, GetFittedOrFixedSize);
 	PUBLIC_FUNCTION(Units, GetUnits);
+	PUBLIC_FUNCTION(int, GetDrawnDrawablesCount);
+	PUBLIC_FUNCTION(int, GetCulledDrawablesCount);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 }
@@ -51,6 +51,11 @@ namespace o2
 	void Component::Update(float dt)
 	{}
 
+	bool Component::IsUpdateThreadSafe() const
+	{
+		return GetType().HasAttribute<ThreadSafeUpdateAttribute>();
+	}
+
 	void Component::SetEnabled(bool active)
 	{
 		if (mEnabled == active)
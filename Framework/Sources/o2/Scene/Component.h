@@ -8,6 +8,16 @@ namespace o2
 	class Actor;
 	class ComponentRef;
 
+	// ---------------------------------------------------------------------------------------------------
+	// Component class attribute: component's Update can be called from any thread in parallel with other
+	// components updates. Such component must change only own data in Update. Mark component class by
+	// @THREAD_SAFE_UPDATE in class comment
+	// ---------------------------------------------------------------------------------------------------
+	class ThreadSafeUpdateAttribute: public IAttribute
+	{
+		ATTRIBUTE_COMMENT_DEFINITION("THREAD_SAFE_UPDATE");
+	};
+
 	// ---------------------------
 	// Actor's component interface
 	// ---------------------------
@@ -41,6 +51,9 @@ namespace o2
 		// Updates component with fixed delta time
 		virtual void FixedUpdate(float dt);
 
+		// Returns is component's type marked by ThreadSafeUpdateAttribute and can be updated in parallel
+		bool IsUpdateThreadSafe() const;
+
 		// Sets component enable
 		virtual void SetEnabled(bool active);
 
@@ -107,7 +120,8 @@ namespace o2
 		bool       mEnabled = true;          // Is component enabled @SERIALIZABLE @EDITOR_IGNORE
 		bool       mResEnabled = true;       // Is component enabled in hierarchy
 
-		Vector<ComponentRef*> mReferences; // References to this component
+		Vector<ComponentRef*> mReferences;    // References to this component
+		Vector<int>           mRegistrySlots; // Indices in scene components registry lists, in order of type and base types
 
 	protected:
 		// Beginning serialization callback
@@ -165,6 +179,7 @@ namespace o2
 		friend class ActorRefResolver;
 		friend class ComponentRef;
 		friend class Scene;
+		friend class SceneComponentsRegistry;
 		friend class Widget;
 	};
 
@@ -183,43 +198,6 @@ namespace o2
 // 		// Checks that type is based on Component type
 // 		bool IsConvertsType(const Type* type) const;
 // 	};
-
-	template<typename _type>
-	Vector<_type*> Component::GetComponentsInChildren() const
-	{
-		if (mOwner)
-			return mOwner->GetComponentsInChildren<_type>();
-
-		return Vector<_type*>();
-	}
-
-	template<typename _type>
-	Vector<_type*> Component::GetComponents() const
-	{
-		if (mOwner)
-			return mOwner->GetComponents();
-
-		return Vector<_type*>();
-	}
-
-	template<typename _type>
-	_type* Component::GetComponentInChildren() const
-	{
-		if (mOwner)
-			return mOwner->GetComponentInChildren<_type>();
-
-		return nullptr;
-	}
-
-	template<typename _type>
-	_type* Component::GetComponent() const
-	{
-		if (mOwner)
-			return mOwner->GetComponent<_type>();
-
-		return nullptr;
-	}
-
 }
 
 CLASS_BASES_META(o2::Component)
@@ -238,6 +216,7 @@ CLASS_FIELDS_META(o2::Component)
 	PROTECTED_FIELD(mEnabled).DEFAULT_VALUE(true).EDITOR_IGNORE_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mResEnabled).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(mReferences);
+	PROTECTED_FIELD(mRegistrySlots);
 }
 END_META;
 CLASS_METHODS_META(o2::Component)
@@ -246,6 +225,7 @@ CLASS_METHODS_META(o2::Component)
 	PUBLIC_FUNCTION(SceneUID, GetID);
 	PUBLIC_FUNCTION(void, Update, float);
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
+	PUBLIC_FUNCTION(bool, IsUpdateThreadSafe);
 	PUBLIC_FUNCTION(void, SetEnabled, bool);
 	PUBLIC_FUNCTION(void, Enable);
 	PUBLIC_FUNCTION(void, Disable);
@@ -278,3 +258,44 @@ CLASS_METHODS_META(o2::Component)
 	PROTECTED_FUNCTION(void, OnComponentRemoving, Component*);
 }
 END_META;
+
+#include "o2/Scene/Actor.h"
+
+namespace o2
+{
+	template<typename _type>
+	Vector<_type*> Component::GetComponentsInChildren() const
+	{
+		if (mOwner)
+			return mOwner->GetComponentsInChildren<_type>();
+
+		return Vector<_type*>();
+	}
+
+	template<typename _type>
+	Vector<_type*> Component::GetComponents() const
+	{
+		if (mOwner)
+			return mOwner->GetComponents<_type>();
+
+		return Vector<_type*>();
+	}
+
+	template<typename _type>
+	_type* Component::GetComponentInChildren() const
+	{
+		if (mOwner)
+			return mOwner->GetComponentInChildren<_type>();
+
+		return nullptr;
+	}
+
+	template<typename _type>
+	_type* Component::GetComponent() const
+	{
+		if (mOwner)
+			return mOwner->GetComponent<_type>();
+
+		return nullptr;
+	}
+}
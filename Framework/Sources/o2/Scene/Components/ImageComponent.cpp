@@ -82,11 +82,21 @@ namespace o2
 	void ImageComponent::OnTransformUpdated()
 	{
 		SetBasis(mOwner->transform->GetWorldBasis());
+		DrawableComponent::OnTransformUpdated();
 	}
 
 	void ImageComponent::SetOwnerActor(Actor* actor)
 	{
 		DrawableComponent::SetOwnerActor(actor);
+		SetSceneDrawableAABBDirty();
+	}
+
+	RectF ImageComponent::CalculateSceneDrawableAABB() const
+	{
+		if (!mOwner)
+			return DrawableComponent::CalculateSceneDrawableAABB();
+
+		return mOwner->transform->GetWorldBasis().AABB();
 	}
 
 	void ImageComponent::OnDeserialized(const DataValue& node)
@@ -101,6 +111,7 @@ namespace o2
 
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::ImageComponent>);
 
 DECLARE_CLASS(o2::ImageComponent);
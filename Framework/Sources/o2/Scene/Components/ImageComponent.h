@@ -74,6 +74,9 @@ namespace o2
 		// Sets owner actor
 		void SetOwnerActor(Actor* actor) override;
 
+		// Calculates world axis aligned bounding box by owner's world basis
+		RectF CalculateSceneDrawableAABB() const override;
+
 		// Calling when deserializing
 		void OnDeserialized(const DataValue& node) override;
 
@@ -102,6 +105,7 @@ CLASS_METHODS_META(o2::ImageComponent)
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PROTECTED_FUNCTION(void, OnTransformUpdated);
 	PROTECTED_FUNCTION(void, SetOwnerActor, Actor*);
+	PROTECTED_FUNCTION(RectF, CalculateSceneDrawableAABB);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, OnSerialize, DataValue&);
 }
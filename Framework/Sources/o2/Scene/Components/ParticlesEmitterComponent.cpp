@@ -61,5 +61,6 @@ namespace o2
 
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::ParticlesEmitterComponent>);
 DECLARE_CLASS(o2::ParticlesEmitterComponent);
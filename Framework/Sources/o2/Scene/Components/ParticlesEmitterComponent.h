@@ -6,6 +6,11 @@
 
 namespace o2
 {
+	// ------------------------------------------------------------------------------------------------
+	// Particles emitter component. Emitter changes only own particles and mesh when updating and takes
+	// random values from own seeded generator, so emitters are updated in parallel by scene and give
+	// same result on any thread. Particles are drawn on main thread @THREAD_SAFE_UPDATE
+	// ------------------------------------------------------------------------------------------------
 	class ParticlesEmitterComponent: public DrawableComponent, public ParticlesEmitter
 	{
 		SERIALIZABLE(ParticlesEmitterComponent);
@@ -45,6 +50,7 @@ CLASS_BASES_META(o2::ParticlesEmitterComponent)
 {
 	BASE_CLASS(o2::DrawableComponent);
 	BASE_CLASS(o2::ParticlesEmitter);
+	CLASS_ATTRIBUTE(o2::ThreadSafeUpdateAttribute);
 }
 END_META;
 CLASS_FIELDS_META(o2::ParticlesEmitterComponent)
@@ -51,7 +51,7 @@ namespace o2
 
 	SceneLayer* DrawableComponent::GetSceneDrawableSceneLayer() const
 	{
-		return mOwner->mLayer;
+		return mOwner ? mOwner->mLayer : nullptr;
 	}
 
 	bool DrawableComponent::IsSceneDrawableEnabled() const
@@ -59,6 +59,16 @@ namespace o2
 		return mResEnabled;
 	}
 
+	Actor* DrawableComponent::GetSceneDrawableActor() const
+	{
+		return mOwner;
+	}
+
+	void DrawableComponent::OnTransformUpdated()
+	{
+		SetSceneDrawableAABBDirty();
+	}
+
 	void DrawableComponent::OnAddToScene()
 	{
 		ISceneDrawable::OnAddToScene();
@@ -38,6 +38,12 @@ namespace o2
 		// Returns is drawable enabled
 		bool IsSceneDrawableEnabled() const override;
 
+		// Returns owner actor
+		Actor* GetSceneDrawableActor() const override;
+
+		// It is called when actor's transform was changed, marks world bounding box as dirty
+		void OnTransformUpdated() override;
+
 		// It is called when actor was included to scene
 		void OnAddToScene();
 
@@ -71,6 +77,8 @@ CLASS_METHODS_META(o2::DrawableComponent)
 	PROTECTED_FUNCTION(void, UpdateEnabled);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(Actor*, GetSceneDrawableActor);
+	PROTECTED_FUNCTION(void, OnTransformUpdated);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 	PUBLIC_FUNCTION(SceneEditableObject*, GetEditableOwner);
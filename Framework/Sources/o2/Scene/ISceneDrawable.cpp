@@ -50,7 +50,7 @@ namespace o2
 	void ISceneDrawable::OnDisabled()
 	{
 		if (auto layer = GetSceneDrawableSceneLayer())
-			layer->OnDrawableEnabled(this);
+			layer->OnDrawableDisabled(this);
 	}
 
 	void ISceneDrawable::OnAddToScene()
@@ -81,6 +81,38 @@ namespace o2
 			layer->SetLastByDepth(this);
 	}
 
+	const RectF& ISceneDrawable::GetSceneDrawableAABB()
+	{
+		if (mSceneDrawableAABBDirty)
+		{
+			mSceneDrawableAABB = CalculateSceneDrawableAABB();
+			mSceneDrawableAABBDirty = false;
+		}
+
+		return mSceneDrawableAABB;
+	}
+
+	RectF ISceneDrawable::CalculateSceneDrawableAABB() const
+	{
+		return RectF(-FLT_MAX, FLT_MAX, FLT_MAX, -FLT_MAX);
+	}
+
+	void ISceneDrawable::SetSceneDrawableAABBDirty()
+	{
+		if (mSceneDrawableAABBDirty)
+			return;
+
+		mSceneDrawableAABBDirty = true;
+
+		if (auto layer = GetSceneDrawableSceneLayer())
+			layer->OnDrawableBoundsChanged(this);
+	}
+
+	Actor* ISceneDrawable::GetSceneDrawableActor() const
+	{
+		return nullptr;
+	}
+
 #if IS_EDITOR
 	SceneEditableObject* ISceneDrawable::GetEditableOwner()
 	{
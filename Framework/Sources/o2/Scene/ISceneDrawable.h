@@ -10,6 +10,7 @@
 
 namespace o2
 {
+	class Actor;
 	class SceneLayer;
 
 	// ------------------------------------------------------------------
@@ -47,18 +48,36 @@ namespace o2
 		// Sets this drawable as last drawing object in layer with same depth
 		void SetLastOnCurrentDepth();
 
+		// Returns cached world axis aligned bounding box. Recalculates it when it is dirty
+		const RectF& GetSceneDrawableAABB();
+
 		SERIALIZABLE(ISceneDrawable);
 
 	protected:
 		float mDrawingDepth = 0.0f; // Drawing depth. Objects with higher depth will be drawn later @SERIALIZABLE
 
+		RectF mSceneDrawableAABB;             // Cached world axis aligned bounding box
+		bool  mSceneDrawableAABBDirty = true; // True when world bounding box must be recalculated
+
+		UInt64 mLayerDrawingOrder = 0;   // Drawing order in layer among drawables with same depth
+		bool   mLayerReordering = false; // True when drawable waits for placing in layer's sorted list
+
 	protected:
+		// Calculates world axis aligned bounding box. By default it's infinite, so drawable is never culled
+		virtual RectF CalculateSceneDrawableAABB() const;
+
+		// Marks world bounding box as dirty, it will be recalculated on next request. Notifies layer spatial index
+		void SetSceneDrawableAABBDirty();
+
 		// Returns current scene layer
 		virtual SceneLayer* GetSceneDrawableSceneLayer() const = 0;
 
 		// Returns is drawable enabled
 		virtual bool IsSceneDrawableEnabled() const = 0;
 
+		// Returns actor, that owns drawable
+		virtual Actor* GetSceneDrawableActor() const;
+
 		// Is is called when drawable has enabled
 		void OnEnabled();
 
@@ -95,6 +114,10 @@ CLASS_FIELDS_META(o2::ISceneDrawable)
 {
 	PUBLIC_FIELD(drawDepth);
 	PROTECTED_FIELD(mDrawingDepth).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mSceneDrawableAABB);
+	PROTECTED_FIELD(mSceneDrawableAABBDirty).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mLayerDrawingOrder).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mLayerReordering).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::ISceneDrawable)
@@ -104,8 +127,12 @@ CLASS_METHODS_META(o2::ISceneDrawable)
 	PUBLIC_FUNCTION(void, SetDrawingDepth, float);
 	PUBLIC_FUNCTION(float, GetSceneDrawableDepth);
 	PUBLIC_FUNCTION(void, SetLastOnCurrentDepth);
+	PUBLIC_FUNCTION(const RectF&, GetSceneDrawableAABB);
+	PROTECTED_FUNCTION(RectF, CalculateSceneDrawableAABB);
+	PROTECTED_FUNCTION(void, SetSceneDrawableAABBDirty);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(Actor*, GetSceneDrawableActor);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
 	PROTECTED_FUNCTION(void, OnAddToScene);
@@ -267,6 +267,7 @@ namespace o2
 
 }
 
+template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::RigidBody>);
 
 ENUM_META(o2::RigidBody::Type)
@@ -13,6 +13,8 @@
 #include "o2/Scene/Tags.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/Tasks/JobSystem.h"
 #include "o2/Render/VectorFontEffects.h"
 
 namespace o2
@@ -36,6 +38,8 @@ namespace o2
 
 	void Scene::Update(float dt)
 	{
+		PROFILE_SCOPE("Scene::Update");
+
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
@@ -44,6 +48,8 @@ namespace o2
 
 	void Scene::FixedUpdate(float dt)
 	{
+		PROFILE_SCOPE("Scene::FixedUpdate");
+
 		for (auto actor : mRootActors)
 			actor->FixedUpdate(dt);
 
@@ -109,18 +115,79 @@ namespace o2
 		mActorsMap[actor->mId] = actor;
 	}
 
+	void Scene::OnActorsHierarchyChanged()
+	{
+		mTransformsStore.SetHierarchyChanged();
+	}
+
+	const Vector<Component*>& Scene::GetAllComponents(const Type& type) const
+	{
+		return mComponentsRegistry.GetComponents(type);
+	}
+
+	void Scene::SetTransformsStoreEnabled(bool enabled)
+	{
+		mTransformsStoreEnabled = enabled;
+		mTransformsStore.Clear();
+	}
+
+	bool Scene::IsTransformsStoreEnabled() const
+	{
+		return mTransformsStoreEnabled;
+	}
+
+	void Scene::SetParallelComponentsUpdateEnabled(bool enabled)
+	{
+		mParallelComponentsUpdateEnabled = enabled;
+	}
+
+	bool Scene::IsParallelComponentsUpdateEnabled() const
+	{
+		return mParallelComponentsUpdateEnabled;
+	}
+
 	void Scene::UpdateActors(float dt)
 	{
+		if (mTransformsStoreEnabled)
+		{
+			PROFILE_SCOPE("Scene transforms");
+			mTransformsStore.Update(mRootActors);
+		}
+
+		mCollectingParallelComponents = mParallelComponentsUpdateEnabled && JobSystem::IsSingletonInitialzed();
+
 		for (auto actor : mRootActors)
 			actor->Update(dt);
 
 		for (auto actor : mRootActors)
 			actor->UpdateChildren(dt);
+
+		mCollectingParallelComponents = false;
+
+		UpdateParallelComponents(dt);
+	}
+
+	void Scene::UpdateParallelComponents(float dt)
+	{
+		if (mParallelUpdateComponents.IsEmpty())
+			return;
+
+		PROFILE_SCOPE("Scene parallel components");
+
+		o2Jobs.ParallelFor(mParallelUpdateComponents.Count(), [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+				mParallelUpdateComponents[i]->Update(dt);
+		}, mParallelComponentsBatchSize);
+
+		mParallelUpdateComponents.Clear();
 	}
 
 #undef DrawText
 	void Scene::Draw()
 	{
+		PROFILE_SCOPE("Scene::Draw");
+
 		if constexpr (IS_EDITOR)
 			BeginDrawingScene();
 
@@ -217,6 +284,8 @@ namespace o2
 		mAllActors.Add(actor);
 		mActorsMap[actor->mId] = actor;
 
+		OnActorsHierarchyChanged();
+
 		actor->OnAddToScene();
 
 		if constexpr (IS_EDITOR)
@@ -238,6 +307,8 @@ namespace o2
 		mStartActors.Remove(actor);
 		mAddedActors.Remove(actor);
 
+		OnActorsHierarchyChanged();
+
 		if constexpr (IS_EDITOR)
 		{
 			if (!keepEditorObjects)
@@ -256,6 +327,17 @@ namespace o2
 	void Scene::OnComponentRemoved(Component* component)
 	{
 		mStartComponents.Remove(component);
+		mParallelUpdateComponents.Remove(component);
+	}
+
+	void Scene::RegComponent(Component* component)
+	{
+		mComponentsRegistry.Add(component);
+	}
+
+	void Scene::UnregComponent(Component* component)
+	{
+		mComponentsRegistry.Remove(component);
 	}
 
 	void Scene::OnLayerRenamed(SceneLayer* layer, const String& oldName)
@@ -465,6 +547,7 @@ namespace o2
 		mAddedActors.Clear();
 		mStartActors.Clear();
 		mStartComponents.Clear();
+		mComponentsRegistry.Clear();
 		mLayers.Clear();
 		mLayersMap.Clear();
 
@@ -756,7 +839,7 @@ namespace o2
 	void Scene::OnActorPrototypeBroken(Actor* actor)
 	{
 		// !!! TODO: Optimize this
-		for (auto& it = mPrototypeLinksCache.Begin(); it != mPrototypeLinksCache.End();)
+		for (auto it = mPrototypeLinksCache.Begin(); it != mPrototypeLinksCache.End();)
 		{
 			it->second.Remove(actor);
 			if (it->second.IsEmpty())
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Scene/SceneComponentsRegistry.h"
+#include "o2/Scene/TransformHierarchyStore.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
 #include "o2/Utils/Types/Containers/Vector.h"
@@ -111,13 +113,28 @@ namespace o2
 		// Returns actor by path (ex "some node/other/target")
 		Actor* FindActor(const String& path);
 
-		// Returns component with type in scene
+		// Returns first added component with type in scene
 		template<typename _type>
 		_type* FindActorComponent();
 
 		// Returns all components with type in scene
 		template<typename _type>
-		Vector<_type>* FindAllActorsComponents();
+		Vector<_type*> FindAllActorsComponents();
+
+		// Returns all components based on type in scene. Doesn't allocate, list is stored by scene
+		const Vector<Component*>& GetAllComponents(const Type& type) const;
+
+		// Enables or disables updating plain actors transforms by flattened transforms hierarchy in one pass
+		void SetTransformsStoreEnabled(bool enabled);
+
+		// Returns is plain actors transforms updated by flattened transforms hierarchy
+		bool IsTransformsStoreEnabled() const;
+
+		// Enables or disables parallel updating of components marked by ThreadSafeUpdateAttribute
+		void SetParallelComponentsUpdateEnabled(bool enabled);
+
+		// Returns is components marked by ThreadSafeUpdateAttribute updated in parallel
+		bool IsParallelComponentsUpdateEnabled() const;
 
 		// Removes all actors
 		void Clear(bool keepDefaultLayer = true);
@@ -172,6 +189,17 @@ namespace o2
 
 		Vector<ActorAssetRef> mCache; // Cached actors assets
 
+		SceneComponentsRegistry mComponentsRegistry; // Scene components grouped by types
+
+		TransformHierarchyStore mTransformsStore;               // Flattened hierarchy of plain actors transforms
+		bool                    mTransformsStoreEnabled = true; // Is plain actors transforms updated by flattened hierarchy
+
+		Vector<Component*> mParallelUpdateComponents;               // Thread safe components, collected in actors update and updated in parallel after it
+		bool               mParallelComponentsUpdateEnabled = true; // Are thread safe components updated in parallel
+		bool               mCollectingParallelComponents = false;   // Is actors updating now and thread safe components must be collected
+
+		static constexpr int mParallelComponentsBatchSize = 16; // Minimal count of components updated by one job
+
 	protected:
 		// Default constructor
 		Scene();
@@ -179,9 +207,13 @@ namespace o2
 		// Destructor
 		~Scene();
 
-		// Updates root actors and their children
+		// Updates root actors and their children. Thread safe components are collected during this and updated in parallel
+		// after all other components
 		void UpdateActors(float dt);
 
+		// Updates collected thread safe components in parallel by job system
+		void UpdateParallelComponents(float dt);
+
 		// Updates just added actors and components
 		void UpdateAddedEntities();
 
@@ -209,12 +241,21 @@ namespace o2
 		// It is called when actor unique id was changed; updates actors map
 		void OnActorIdChanged(Actor* actor, SceneUID prevId);
 
+		// It is called when actors hierarchy was changed; flattened transforms hierarchy will be rebuilt
+		void OnActorsHierarchyChanged();
+
 		// It is called when component added to actor, registers for calling OnAddOnScene
 		void OnComponentAdded(Component* component);
 
 		// It is called when component removed, register for calling OnRemovFromScene
 		void OnComponentRemoved(Component* component);
 
+		// Registers component on scene in components registry
+		void RegComponent(Component* component);
+
+		// Removes component from components registry
+		void UnregComponent(Component* component);
+
 		// It is called when scene layer renamed, updates layers map
 		void OnLayerRenamed(SceneLayer* layer, const String& oldName);
 
@@ -316,11 +357,14 @@ namespace o2
 namespace o2
 {
 	template<typename _type>
-	Vector<_type>* Scene::FindAllActorsComponents()
+	Vector<_type*> Scene::FindAllActorsComponents()
 	{
-		Vector<_type>* res = mnew Vector<_type>();
-		for (auto actor : mRootActors)
-			res->Add(actor->GetComponentsInChildren<_type>());
+		auto& components = mComponentsRegistry.GetComponents(TypeOf(_type));
+
+		Vector<_type*> res;
+		res.Reserve(components.Count());
+		for (auto component : components)
+			res.Add(Reflection::Cast<_type>(component));
 
 		return res;
 	}
@@ -328,14 +372,7 @@ namespace o2
 	template<typename _type>
 	_type* Scene::FindActorComponent()
 	{
-		for (auto actor : mRootActors)
-		{
-			_type* res = actor->GetComponentInChildren<_type>();
-			if (res)
-				return res;
-		}
-
-		return nullptr;
+		return Reflection::Cast<_type>(mComponentsRegistry.GetComponent(TypeOf(_type)));
 	}
 };
 
@@ -369,6 +406,12 @@ CLASS_FIELDS_META(o2::Scene)
 	PROTECTED_FIELD(mDefaultLayer);
 	PROTECTED_FIELD(mTags);
 	PROTECTED_FIELD(mCache);
+	PROTECTED_FIELD(mComponentsRegistry);
+	PROTECTED_FIELD(mTransformsStore);
+	PROTECTED_FIELD(mTransformsStoreEnabled).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mParallelUpdateComponents);
+	PROTECTED_FIELD(mParallelComponentsUpdateEnabled).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mCollectingParallelComponents).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mPrototypeLinksCache);
 	PROTECTED_FIELD(mChangedObjects);
 	PROTECTED_FIELD(mEditableObjects);
@@ -404,6 +447,11 @@ CLASS_METHODS_META(o2::Scene)
 	PUBLIC_FUNCTION(Actor*, GetActorByID, SceneUID);
 	PUBLIC_FUNCTION(Actor*, GetAssetActorByID, const UID&);
 	PUBLIC_FUNCTION(Actor*, FindActor, const String&);
+	PUBLIC_FUNCTION(const Vector<Component*>&, GetAllComponents, const Type&);
+	PUBLIC_FUNCTION(void, SetTransformsStoreEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsTransformsStoreEnabled);
+	PUBLIC_FUNCTION(void, SetParallelComponentsUpdateEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsParallelComponentsUpdateEnabled);
 	PUBLIC_FUNCTION(void, Clear, bool);
 	PUBLIC_FUNCTION(void, ClearCache);
 	PUBLIC_FUNCTION(void, Load, const String&, bool);
@@ -414,6 +462,7 @@ CLASS_METHODS_META(o2::Scene)
 	PUBLIC_FUNCTION(void, Update, float);
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
 	PROTECTED_FUNCTION(void, UpdateActors, float);
+	PROTECTED_FUNCTION(void, UpdateParallelComponents, float);
 	PROTECTED_FUNCTION(void, UpdateAddedEntities);
 	PROTECTED_FUNCTION(void, UpdateStartingEntities);
 	PROTECTED_FUNCTION(void, UpdateDestroyingEntities);
@@ -423,8 +472,11 @@ CLASS_METHODS_META(o2::Scene)
 	PROTECTED_FUNCTION(void, AddActorToSceneDeferred, Actor*);
 	PROTECTED_FUNCTION(void, RemoveActorFromScene, Actor*, bool);
 	PROTECTED_FUNCTION(void, OnActorIdChanged, Actor*, SceneUID);
+	PROTECTED_FUNCTION(void, OnActorsHierarchyChanged);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoved, Component*);
+	PROTECTED_FUNCTION(void, RegComponent, Component*);
+	PROTECTED_FUNCTION(void, UnregComponent, Component*);
 	PROTECTED_FUNCTION(void, OnLayerRenamed, SceneLayer*, const String&);
 	PROTECTED_FUNCTION(void, OnCameraAddedOnScene, CameraActor*);
 	PROTECTED_FUNCTION(void, OnCameraRemovedScene, CameraActor*);
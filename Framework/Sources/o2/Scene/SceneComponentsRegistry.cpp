@@ -0,0 +1,121 @@
+#include "o2/stdafx.h"
+#include "SceneComponentsRegistry.h"
+
+#include "o2/Scene/Component.h"
+
+namespace o2
+{
+	SceneComponentsRegistry::~SceneComponentsRegistry()
+	{
+		for (auto list : mComponentsByType)
+			delete list;
+
+		for (auto fanOut : mTypesFanOut)
+			delete fanOut;
+	}
+
+	void SceneComponentsRegistry::Add(Component* component)
+	{
+		if (!component->mRegistrySlots.IsEmpty())
+			return;
+
+		auto& fanOut = GetTypeFanOut(component->GetType());
+		component->mRegistrySlots.Reserve(fanOut.Count());
+
+		for (auto type : fanOut)
+		{
+			if (type->ID() >= (UInt)mComponentsByType.Count())
+				mComponentsByType.Resize(type->ID() + 1);
+
+			auto& list = mComponentsByType[type->ID()];
+			if (!list)
+				list = mnew Vector<Component*>();
+
+			component->mRegistrySlots.Add(list->Count());
+			list->Add(component);
+		}
+	}
+
+	void SceneComponentsRegistry::Remove(Component* component)
+	{
+		if (component->mRegistrySlots.IsEmpty())
+			return;
+
+		auto& fanOut = GetTypeFanOut(component->GetType());
+		for (int i = 0; i < fanOut.Count(); i++)
+		{
+			const Type* type = fanOut[i];
+			auto& list = *mComponentsByType[type->ID()];
+			int slot = component->mRegistrySlots[i];
+
+			Component* last = list.Last();
+			if (last != component)
+			{
+				list[slot] = last;
+
+				auto& lastFanOut = GetTypeFanOut(last->GetType());
+				last->mRegistrySlots[lastFanOut.IndexOf(type)] = slot;
+			}
+
+			list.PopBack();
+		}
+
+		component->mRegistrySlots.Clear();
+	}
+
+	const Vector<Component*>& SceneComponentsRegistry::GetComponents(const Type& type) const
+	{
+		static Vector<Component*> empty;
+
+		if (type.ID() >= (UInt)mComponentsByType.Count() || !mComponentsByType[type.ID()])
+			return empty;
+
+		return *mComponentsByType[type.ID()];
+	}
+
+	Component* SceneComponentsRegistry::GetComponent(const Type& type) const
+	{
+		auto& components = GetComponents(type);
+		return components.IsEmpty() ? nullptr : components[0];
+	}
+
+	void SceneComponentsRegistry::Clear()
+	{
+		for (auto list : mComponentsByType)
+		{
+			if (!list)
+				continue;
+
+			for (auto component : *list)
+				component->mRegistrySlots.Clear();
+
+			list->Clear();
+		}
+	}
+
+	const Vector<const Type*>& SceneComponentsRegistry::GetTypeFanOut(const Type& type)
+	{
+		if (type.ID() >= (UInt)mTypesFanOut.Count())
+			mTypesFanOut.Resize(type.ID() + 1);
+
+		auto& fanOut = mTypesFanOut[type.ID()];
+		if (!fanOut)
+		{
+			fanOut = mnew Vector<const Type*>();
+			CollectFanOut(type, *fanOut);
+		}
+
+		return *fanOut;
+	}
+
+	void SceneComponentsRegistry::CollectFanOut(const Type& type, Vector<const Type*>& fanOut)
+	{
+		if (!type.IsBasedOn(TypeOf(Component)) || fanOut.Contains(&type))
+			return;
+
+		fanOut.Add(&type);
+
+		for (auto& baseType : type.GetBaseTypes())
+			CollectFanOut(*baseType.type, fanOut);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Component;
+	class Type;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Registry of scene components grouped by type. Lists are indexed by type id, component is listed for its
+	// own type and for all base component types, so components of any type are got without walking actors.
+	// Base types list of each component type is collected once, when first component of this type is added.
+	// Component keeps its indices in lists, so it is removed by swapping with last component in each list
+	// -------------------------------------------------------------------------------------------------------
+	class SceneComponentsRegistry
+	{
+	public:
+		// Destructor
+		~SceneComponentsRegistry();
+
+		// Adds component into lists of its type and base types
+		void Add(Component* component);
+
+		// Removes component from lists of its type and base types
+		void Remove(Component* component);
+
+		// Returns components based on type. Order isn't kept when components are removed
+		const Vector<Component*>& GetComponents(const Type& type) const;
+
+		// Returns any component based on type, or nullptr
+		Component* GetComponent(const Type& type) const;
+
+		// Removes all components
+		void Clear();
+
+	protected:
+		Vector<Vector<Component*>*>  mComponentsByType; // Components lists indexed by type id
+		Vector<Vector<const Type*>*> mTypesFanOut;      // Type and its base component types, indexed by type id
+
+	protected:
+		// Returns type and its base component types, collects them at first call
+		const Vector<const Type*>& GetTypeFanOut(const Type& type);
+
+		// Collects type and its base types based on Component into list
+		static void CollectFanOut(const Type& type, Vector<const Type*>& fanOut);
+	};
+}
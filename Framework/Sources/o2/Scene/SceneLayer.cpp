@@ -40,6 +40,7 @@ namespace o2
 
 	const Vector<ISceneDrawable*>& SceneLayer::GetEnabledDrawables() const
 	{
+		UpdateEnabledDrawablesOrder();
 		return mEnabledDrawables;
 	}
 
@@ -75,68 +76,162 @@ namespace o2
 
 	void SceneLayer::OnDrawableDepthChanged(ISceneDrawable* drawable)
 	{
-		OnDrawableDisabled(drawable);
-		OnDrawableEnabled(drawable);
+		if (!mSpatialIndex.Contains(drawable))
+			return;
+
+		AddReorderingDrawable(drawable);
 	}
 
 	void SceneLayer::OnDrawableEnabled(ISceneDrawable* drawable)
 	{
-		const int binSearchRangeSizeStop = 5;
-		int rangeMin = 0, rangeMax = mEnabledDrawables.Count();
-		float targetDepth = drawable->mDrawingDepth;
-		int position = 0;
-		bool skipLinearSearch = false;
+		if (mSpatialIndex.Contains(drawable))
+			return;
 
-		while (rangeMax - rangeMin > binSearchRangeSizeStop)
-		{
-			int center = (rangeMin + rangeMax) >> 1;
+		drawable->mLayerDrawingOrder = mNextDrawableOrder++;
+		AddReorderingDrawable(drawable);
 
-			float centerValue = mEnabledDrawables[center]->mDrawingDepth;
+		mSpatialIndex.Add(drawable);
+	}
 
-			if (targetDepth < centerValue)
-				rangeMax = center;
-			else if (targetDepth > centerValue)
-				rangeMin = center;
-			else
-			{
-				position = center;
-				skipLinearSearch = true;
-				break;
-			}
-		}
+	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable)
+	{
+		if (!mSpatialIndex.Contains(drawable))
+			return;
 
-		if (!skipLinearSearch)
+		if (drawable->mLayerReordering)
 		{
-			for (position = rangeMin; position < rangeMax; position++)
-				if (mEnabledDrawables[position]->mDrawingDepth > targetDepth)
-					break;
+			drawable->mLayerReordering = false;
+			mReorderingDrawables.Remove(drawable);
 		}
 
-		mEnabledDrawables.Insert(drawable, position);
+		mEnabledDrawables.Remove(drawable);
+		mSpatialIndex.Remove(drawable);
 	}
 
-	void SceneLayer::OnDrawableDisabled(ISceneDrawable* drawable)
+	void SceneLayer::SetLastByDepth(ISceneDrawable* drawable)
 	{
-		mEnabledDrawables.Remove(drawable);
+		if (!mSpatialIndex.Contains(drawable))
+			return;
+
+		drawable->mLayerDrawingOrder = mNextDrawableOrder++;
+		AddReorderingDrawable(drawable);
 	}
 
-	void SceneLayer::SetLastByDepth(ISceneDrawable* drawable)
+	void SceneLayer::OnDrawableBoundsChanged(ISceneDrawable* drawable)
+	{
+		mSpatialIndex.OnBoundsChanged(drawable);
+	}
+
+	void SceneLayer::AddReorderingDrawable(ISceneDrawable* drawable)
+	{
+		if (drawable->mLayerReordering)
+			return;
+
+		drawable->mLayerReordering = true;
+		mReorderingDrawables.Add(drawable);
+	}
+
+	void SceneLayer::UpdateEnabledDrawablesOrder() const
+	{
+		if (mReorderingDrawables.IsEmpty())
+			return;
+
+		// Reordering drawables are taken out of sorted list, sorted between themselves and merged back.
+		// It takes O(n + k*log(k)) for k changed drawables instead of O(n) per each changed drawable
+		auto removeIt = std::remove_if(mEnabledDrawables.begin(), mEnabledDrawables.end(),
+									   [](ISceneDrawable* drawable) { return drawable->mLayerReordering; });
+
+		mEnabledDrawables.erase(removeIt, mEnabledDrawables.end());
+
+		std::sort(mReorderingDrawables.begin(), mReorderingDrawables.end(), &SceneLayer::IsDrawableDrawingEarlier);
+
+		mEnabledDrawablesBuffer.Clear();
+		mEnabledDrawablesBuffer.Reserve(mEnabledDrawables.Count() + mReorderingDrawables.Count());
+
+		std::merge(mEnabledDrawables.begin(), mEnabledDrawables.end(),
+				   mReorderingDrawables.begin(), mReorderingDrawables.end(),
+				   std::back_inserter(mEnabledDrawablesBuffer), &SceneLayer::IsDrawableDrawingEarlier);
+
+		std::swap(mEnabledDrawables, mEnabledDrawablesBuffer);
+
+		for (auto drawable : mReorderingDrawables)
+			drawable->mLayerReordering = false;
+
+		mReorderingDrawables.Clear();
+	}
+
+	bool SceneLayer::IsDrawableDrawingEarlier(const ISceneDrawable* a, const ISceneDrawable* b)
+	{
+		if (a->mDrawingDepth != b->mDrawingDepth)
+			return a->mDrawingDepth < b->mDrawingDepth;
+
+		return a->mLayerDrawingOrder < b->mLayerDrawingOrder;
+	}
+
+	Vector<ISceneDrawable*> SceneLayer::FindDrawables(const RectF& rect)
+	{
+		Vector<ISceneDrawable*> res;
+		mSpatialIndex.Query(rect, res);
+		SortDrawablesByDepth(res);
+		return res;
+	}
+
+	Vector<ISceneDrawable*> SceneLayer::FindDrawables(const Vec2F& point)
+	{
+		Vector<ISceneDrawable*> res;
+		mSpatialIndex.Query(point, res);
+		SortDrawablesByDepth(res);
+		return res;
+	}
+
+	Vector<ISceneDrawable*> SceneLayer::FindDrawables(const Vec2F& center, float radius)
+	{
+		Vector<ISceneDrawable*> res;
+		mSpatialIndex.Query(center, radius, res);
+		SortDrawablesByDepth(res);
+		return res;
+	}
+
+	Vector<Actor*> SceneLayer::FindActors(const RectF& rect)
 	{
-		OnDrawableDisabled(drawable);
+		return GetDrawablesActors(FindDrawables(rect));
+	}
+
+	Vector<Actor*> SceneLayer::FindActors(const Vec2F& point)
+	{
+		return GetDrawablesActors(FindDrawables(point));
+	}
 
-		for (int position = 0; position < mEnabledDrawables.Count(); position++)
+	Vector<Actor*> SceneLayer::FindActors(const Vec2F& center, float radius)
+	{
+		return GetDrawablesActors(FindDrawables(center, radius));
+	}
+
+	SceneSpatialIndex& SceneLayer::GetSpatialIndex()
+	{
+		return mSpatialIndex;
+	}
+
+	void SceneLayer::SortDrawablesByDepth(Vector<ISceneDrawable*>& drawables)
+	{
+		std::sort(drawables.begin(), drawables.end(), &SceneLayer::IsDrawableDrawingEarlier);
+	}
+
+	Vector<Actor*> SceneLayer::GetDrawablesActors(const Vector<ISceneDrawable*>& drawables)
+	{
+		Vector<Actor*> res;
+		for (auto drawable : drawables)
 		{
-			if (mEnabledDrawables[position]->mDrawingDepth > drawable->mDrawingDepth)
+			if (auto actor = drawable->GetSceneDrawableActor())
 			{
-				mEnabledDrawables.Insert(drawable, position);
-				return;
+				if (!res.Contains(actor))
+					res.Add(actor);
 			}
 		}
 
-		mEnabledDrawables.Add(drawable);
+		return res;
 	}
 
-
 // 	void LayerDataValueConverter::ToData(void* object, DataValue& data)
 // 	{
 // 		if (object)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Scene/SceneSpatialIndex.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
@@ -33,9 +34,30 @@ namespace o2
 		// Returns all drawable objects of actors in layer
 		const Vector<ISceneDrawable*>& GetDrawables() const;
 
-		// Returns enabled drawable objects of actors in layer
+		// Returns enabled drawable objects of actors in layer, sorted by depth. Applies deferred depth changes
 		const Vector<ISceneDrawable*>& GetEnabledDrawables() const;
 
+		// Returns enabled drawables with bounds intersecting rectangle, sorted by depth
+		Vector<ISceneDrawable*> FindDrawables(const RectF& rect);
+
+		// Returns enabled drawables with bounds containing point, sorted by depth
+		Vector<ISceneDrawable*> FindDrawables(const Vec2F& point);
+
+		// Returns enabled drawables with bounds intersecting circle, sorted by depth
+		Vector<ISceneDrawable*> FindDrawables(const Vec2F& center, float radius);
+
+		// Returns actors of enabled drawables with bounds intersecting rectangle, sorted by depth
+		Vector<Actor*> FindActors(const RectF& rect);
+
+		// Returns actors of enabled drawables with bounds containing point, sorted by depth
+		Vector<Actor*> FindActors(const Vec2F& point);
+
+		// Returns actors of enabled drawables with bounds intersecting circle, sorted by depth
+		Vector<Actor*> FindActors(const Vec2F& center, float radius);
+
+		// Returns spatial index of enabled drawables
+		SceneSpatialIndex& GetSpatialIndex();
+
 		SERIALIZABLE(SceneLayer);
 
 	protected:
@@ -44,8 +66,13 @@ namespace o2
 		Vector<Actor*>  mActors;        // Actors in layer
 		Vector<Actor*>  mEnabledActors; // Enabled actors
 
-		Vector<ISceneDrawable*> mDrawables;        // Drawable objects in layer
-		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer
+		Vector<ISceneDrawable*>         mDrawables;              // Drawable objects in layer
+		mutable Vector<ISceneDrawable*> mEnabledDrawables;       // Enabled drawable objects in layer, sorted by depth and order
+		mutable Vector<ISceneDrawable*> mReorderingDrawables;    // Enabled drawables with changed depth or order, waiting for merge into sorted list
+		mutable Vector<ISceneDrawable*> mEnabledDrawablesBuffer; // Temporary buffer for merging reordering drawables
+		UInt64                          mNextDrawableOrder = 1;  // Order index for next enabled or moved to last drawable
+
+		SceneSpatialIndex mSpatialIndex; // Spatial index of enabled drawables by their world bounds
 
 	protected:
 		// Registers actor in list
@@ -66,7 +93,7 @@ namespace o2
 		// Unregisters drawable object
 		void UnregisterDrawable(ISceneDrawable* drawable);
 
-		// It is called when drawable object depth was changed and sorts all drawable component
+		// It is called when drawable object depth was changed. Drawable will be moved in sorted list on next access
 		void OnDrawableDepthChanged(ISceneDrawable* drawable);
 
 		// It is called when object was enabled
@@ -78,6 +105,24 @@ namespace o2
 		// Sets drawable order as last of all objects with same depth
 		void SetLastByDepth(ISceneDrawable* drawable);
 
+		// It is called when drawable world bounds was changed, updates spatial index
+		void OnDrawableBoundsChanged(ISceneDrawable* drawable);
+
+		// Marks drawable as waiting for placing in sorted enabled drawables list
+		void AddReorderingDrawable(ISceneDrawable* drawable);
+
+		// Merges reordering drawables into sorted enabled drawables list
+		void UpdateEnabledDrawablesOrder() const;
+
+		// Returns true when drawable a must be drawn before drawable b
+		static bool IsDrawableDrawingEarlier(const ISceneDrawable* a, const ISceneDrawable* b);
+
+		// Sorts drawables by depth
+		static void SortDrawablesByDepth(Vector<ISceneDrawable*>& drawables);
+
+		// Returns unique actors of drawables in same order
+		static Vector<Actor*> GetDrawablesActors(const Vector<ISceneDrawable*>& drawables);
+
 		friend class Actor;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -116,6 +161,10 @@ CLASS_FIELDS_META(o2::SceneLayer)
 	PROTECTED_FIELD(mEnabledActors);
 	PROTECTED_FIELD(mDrawables);
 	PROTECTED_FIELD(mEnabledDrawables);
+	PROTECTED_FIELD(mReorderingDrawables);
+	PROTECTED_FIELD(mEnabledDrawablesBuffer);
+	PROTECTED_FIELD(mNextDrawableOrder).DEFAULT_VALUE(1);
+	PROTECTED_FIELD(mSpatialIndex);
 }
 END_META;
 CLASS_METHODS_META(o2::SceneLayer)
@@ -127,6 +176,13 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PUBLIC_FUNCTION(const Vector<Actor*>&, GetEnabledActors);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetDrawables);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetEnabledDrawables);
+	PUBLIC_FUNCTION(Vector<ISceneDrawable*>, FindDrawables, const RectF&);
+	PUBLIC_FUNCTION(Vector<ISceneDrawable*>, FindDrawables, const Vec2F&);
+	PUBLIC_FUNCTION(Vector<ISceneDrawable*>, FindDrawables, const Vec2F&, float);
+	PUBLIC_FUNCTION(Vector<Actor*>, FindActors, const RectF&);
+	PUBLIC_FUNCTION(Vector<Actor*>, FindActors, const Vec2F&);
+	PUBLIC_FUNCTION(Vector<Actor*>, FindActors, const Vec2F&, float);
+	PUBLIC_FUNCTION(SceneSpatialIndex&, GetSpatialIndex);
 	PROTECTED_FUNCTION(void, RegisterActor, Actor*);
 	PROTECTED_FUNCTION(void, UnregisterActor, Actor*);
 	PROTECTED_FUNCTION(void, OnActorEnabled, Actor*);
@@ -137,5 +193,11 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PROTECTED_FUNCTION(void, OnDrawableEnabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, OnDrawableDisabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, SetLastByDepth, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, OnDrawableBoundsChanged, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, AddReorderingDrawable, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, UpdateEnabledDrawablesOrder);
+	PROTECTED_STATIC_FUNCTION(bool, IsDrawableDrawingEarlier, const ISceneDrawable*, const ISceneDrawable*);
+	PROTECTED_STATIC_FUNCTION(void, SortDrawablesByDepth, Vector<ISceneDrawable*>&);
+	PROTECTED_STATIC_FUNCTION(Vector<Actor*>, GetDrawablesActors, const Vector<ISceneDrawable*>&);
 }
 END_META;
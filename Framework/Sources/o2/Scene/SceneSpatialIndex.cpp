@@ -0,0 +1,219 @@
+#include "o2/stdafx.h"
+#include "SceneSpatialIndex.h"
+
+#include "o2/Scene/ISceneDrawable.h"
+
+namespace o2
+{
+	SceneSpatialIndex::SceneSpatialIndex(float cellSize /*= 256.0f*/):
+		mCellSize(cellSize), mInvCellSize(1.0f/cellSize)
+	{}
+
+	SceneSpatialIndex::~SceneSpatialIndex()
+	{}
+
+	void SceneSpatialIndex::Add(ISceneDrawable* drawable)
+	{
+		if (mEntries.find(drawable) != mEntries.end())
+			return;
+
+		Entry& entry = mEntries[drawable];
+		entry.drawable = drawable;
+		Insert(entry);
+	}
+
+	void SceneSpatialIndex::Remove(ISceneDrawable* drawable)
+	{
+		auto fnd = mEntries.find(drawable);
+		if (fnd == mEntries.end())
+			return;
+
+		Entry& entry = fnd->second;
+		Erase(entry);
+
+		if (entry.dirty)
+			mDirtyEntries.Remove(&entry);
+
+		mEntries.erase(fnd);
+	}
+
+	void SceneSpatialIndex::OnBoundsChanged(ISceneDrawable* drawable)
+	{
+		auto fnd = mEntries.find(drawable);
+		if (fnd == mEntries.end() || fnd->second.dirty)
+			return;
+
+		fnd->second.dirty = true;
+		mDirtyEntries.Add(&fnd->second);
+	}
+
+	bool SceneSpatialIndex::Contains(ISceneDrawable* drawable) const
+	{
+		return mEntries.find(drawable) != mEntries.end();
+	}
+
+	void SceneSpatialIndex::Query(const RectF& rect, Vector<ISceneDrawable*>& result)
+	{
+		UpdateDirtyEntries();
+
+		ForEachEntry(GetCellsRange(rect), [&](Entry& entry)
+		{
+			if (entry.bounds.IsIntersects(rect))
+				result.Add(entry.drawable);
+		});
+	}
+
+	void SceneSpatialIndex::Query(const Vec2F& point, Vector<ISceneDrawable*>& result)
+	{
+		UpdateDirtyEntries();
+
+		RectF pointRect(point, point);
+		ForEachEntry(GetCellsRange(pointRect), [&](Entry& entry)
+		{
+			if (point.x >= entry.bounds.left && point.x <= entry.bounds.right &&
+				point.y >= entry.bounds.bottom && point.y <= entry.bounds.top)
+			{
+				result.Add(entry.drawable);
+			}
+		});
+	}
+
+	void SceneSpatialIndex::Query(const Vec2F& center, float radius, Vector<ISceneDrawable*>& result)
+	{
+		UpdateDirtyEntries();
+
+		RectF circleRect(center - Vec2F(radius, radius), center + Vec2F(radius, radius));
+		float sqrRadius = radius*radius;
+
+		ForEachEntry(GetCellsRange(circleRect), [&](Entry& entry)
+		{
+			Vec2F closest(Math::Clamp(center.x, entry.bounds.left, entry.bounds.right),
+						  Math::Clamp(center.y, entry.bounds.bottom, entry.bounds.top));
+
+			if ((closest - center).SqrLength() <= sqrRadius)
+				result.Add(entry.drawable);
+		});
+	}
+
+	void SceneSpatialIndex::SetCellSize(float size)
+	{
+		mCellSize = size;
+		mInvCellSize = 1.0f/size;
+
+		mCells.clear();
+		mLargeEntries.Clear();
+		mDirtyEntries.Clear();
+
+		for (auto& kv : mEntries)
+		{
+			kv.second.dirty = false;
+			Insert(kv.second);
+		}
+	}
+
+	float SceneSpatialIndex::GetCellSize() const
+	{
+		return mCellSize;
+	}
+
+	void SceneSpatialIndex::Clear()
+	{
+		mEntries.clear();
+		mCells.clear();
+		mLargeEntries.Clear();
+		mDirtyEntries.Clear();
+	}
+
+	void SceneSpatialIndex::UpdateDirtyEntries()
+	{
+		for (auto entry : mDirtyEntries)
+		{
+			entry->dirty = false;
+
+			RectF bounds = entry->drawable->GetSceneDrawableAABB();
+			if (bounds == entry->bounds)
+				continue;
+
+			if (!entry->large && GetCellsRange(bounds) == entry->cells)
+			{
+				entry->bounds = bounds;
+				continue;
+			}
+
+			Erase(*entry);
+			Insert(*entry);
+		}
+
+		mDirtyEntries.Clear();
+	}
+
+	void SceneSpatialIndex::Insert(Entry& entry)
+	{
+		entry.bounds = entry.drawable->GetSceneDrawableAABB();
+		entry.cells = GetCellsRange(entry.bounds);
+
+		// Large is decided by count of occupied cells, not by area: long thin bounds have small area but occupy many cells
+		UInt64 cellsCount = (UInt64)((Int64)entry.cells.right - entry.cells.left + 1)*
+			(UInt64)((Int64)entry.cells.top - entry.cells.bottom + 1);
+
+		entry.large = cellsCount > (UInt64)mMaxCellsPerEntry;
+
+		if (entry.large)
+		{
+			entry.largeIdx = mLargeEntries.Count();
+			mLargeEntries.Add(&entry);
+			return;
+		}
+
+		for (int x = entry.cells.left; x <= entry.cells.right; x++)
+		{
+			for (int y = entry.cells.bottom; y <= entry.cells.top; y++)
+				mCells[GetCellKey(x, y)].Add(&entry);
+		}
+	}
+
+	void SceneSpatialIndex::Erase(Entry& entry)
+	{
+		if (entry.large)
+		{
+			Entry* last = mLargeEntries.PopBack();
+			if (last != &entry)
+			{
+				last->largeIdx = entry.largeIdx;
+				mLargeEntries[entry.largeIdx] = last;
+			}
+
+			entry.largeIdx = -1;
+			return;
+		}
+
+		for (int x = entry.cells.left; x <= entry.cells.right; x++)
+		{
+			for (int y = entry.cells.bottom; y <= entry.cells.top; y++)
+			{
+				auto fnd = mCells.find(GetCellKey(x, y));
+				if (fnd == mCells.end())
+					continue;
+
+				fnd->second.Remove(&entry);
+				if (fnd->second.IsEmpty())
+					mCells.erase(fnd);
+			}
+		}
+	}
+
+	RectI SceneSpatialIndex::GetCellsRange(const RectF& rect) const
+	{
+		const float limit = (float)(INT_MAX/2);
+
+		return RectI((int)Math::Floor(Math::Clamp(rect.left*mInvCellSize, -limit, limit)),
+					 (int)Math::Floor(Math::Clamp(rect.top*mInvCellSize, -limit, limit)),
+					 (int)Math::Floor(Math::Clamp(rect.right*mInvCellSize, -limit, limit)),
+					 (int)Math::Floor(Math::Clamp(rect.bottom*mInvCellSize, -limit, limit)));
+	}
+
+	UInt64 SceneSpatialIndex::GetCellKey(int x, int y)
+	{
+		return ((UInt64)(UInt)x << 32) | (UInt64)(UInt)y;
+	}
+}
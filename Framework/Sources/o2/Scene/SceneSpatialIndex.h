@@ -0,0 +1,151 @@
+#pragma once
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class ISceneDrawable;
+
+	// -----------------------------------------------------------------------------------------------------
+	// Spatial index of scene drawables. Loose uniform grid, where each drawable is placed into all cells its
+	// world bounding box overlaps. Drawables with huge or infinite bounds are stored in separate list and 
+	// are returned by every query. Drawables with changed bounds are updated lazily before next query
+	// -----------------------------------------------------------------------------------------------------
+	class SceneSpatialIndex
+	{
+	public:
+		// Constructor
+		SceneSpatialIndex(float cellSize = 256.0f);
+
+		// Destructor
+		~SceneSpatialIndex();
+
+		// Adds drawable into index
+		void Add(ISceneDrawable* drawable);
+
+		// Removes drawable from index
+		void Remove(ISceneDrawable* drawable);
+
+		// Marks drawable bounds as changed, it will be replaced before next query
+		void OnBoundsChanged(ISceneDrawable* drawable);
+
+		// Returns true when drawable is in index
+		bool Contains(ISceneDrawable* drawable) const;
+
+		// Searches drawables with bounds intersecting rectangle and adds them into result. Order is undefined
+		void Query(const RectF& rect, Vector<ISceneDrawable*>& result);
+
+		// Searches drawables with bounds containing point and adds them into result. Order is undefined
+		void Query(const Vec2F& point, Vector<ISceneDrawable*>& result);
+
+		// Searches drawables with bounds intersecting circle and adds them into result. Order is undefined
+		void Query(const Vec2F& center, float radius, Vector<ISceneDrawable*>& result);
+
+		// Sets grid cell size and rebuilds index
+		void SetCellSize(float size);
+
+		// Returns grid cell size
+		float GetCellSize() const;
+
+		// Removes all drawables
+		void Clear();
+
+	protected:
+		// -------------------------------
+		// Drawable entry in spatial index
+		// -------------------------------
+		struct Entry
+		{
+			ISceneDrawable* drawable = nullptr; // Indexed drawable
+			RectF           bounds;             // Bounds of drawable at insertion
+			RectI           cells;              // Range of occupied cells, inclusive
+			bool            large = false;      // True when drawable is too large for grid and stored in large list
+			int             largeIdx = -1;      // Index in large entries list, used for removing by swap with last
+			bool            dirty = false;      // True when bounds was changed and entry waits for update
+			UInt            queryMark = 0;      // Last query index, used for skipping duplicates
+		};
+
+		typedef Vector<Entry*> EntriesVec;
+
+	protected:
+		static constexpr int mMaxCellsPerEntry = 64; // Entries occupying more cells are stored in large list
+
+		float mCellSize;    // Size of grid cell
+		float mInvCellSize; // Inverted size of grid cell
+
+		Map<ISceneDrawable*, Entry> mEntries;      // All entries by drawables
+		Map<UInt64, EntriesVec>     mCells;        // Grid cells by packed coordinates
+		EntriesVec                  mLargeEntries; // Entries that are too large for grid
+		EntriesVec                  mDirtyEntries; // Entries waiting for update
+
+		UInt mQueryMark = 0; // Current query index
+
+	protected:
+		// Updates all dirty entries
+		void UpdateDirtyEntries();
+
+		// Inserts entry into grid cells by its drawable current bounds
+		void Insert(Entry& entry);
+
+		// Removes entry from grid cells
+		void Erase(Entry& entry);
+
+		// Returns range of cells overlapped by rectangle, inclusive
+		RectI GetCellsRange(const RectF& rect) const;
+
+		// Returns packed cell coordinates key
+		static UInt64 GetCellKey(int x, int y);
+
+		// Calls function for each unique entry in cells range and in large list
+		template<typename _func_type>
+		void ForEachEntry(const RectI& cells, const _func_type& func);
+	};
+
+	template<typename _func_type>
+	void SceneSpatialIndex::ForEachEntry(const RectI& cells, const _func_type& func)
+	{
+		mQueryMark++;
+
+		for (auto entry : mLargeEntries)
+			func(*entry);
+
+		auto processCell = [&](const EntriesVec& cell)
+		{
+			for (auto entry : cell)
+			{
+				if (entry->queryMark == mQueryMark)
+					continue;
+
+				entry->queryMark = mQueryMark;
+				func(*entry);
+			}
+		};
+
+		UInt64 rangeCellsCount = (UInt64)(cells.right - cells.left + 1)*(UInt64)(cells.top - cells.bottom + 1);
+		if (rangeCellsCount > (UInt64)mCells.size())
+		{
+			for (auto& kv : mCells)
+			{
+				int x = (int)(kv.first >> 32), y = (int)(UInt)(kv.first & 0xffffffff);
+				if (x >= cells.left && x <= cells.right && y >= cells.bottom && y <= cells.top)
+					processCell(kv.second);
+			}
+
+			return;
+		}
+
+		for (int x = cells.left; x <= cells.right; x++)
+		{
+			for (int y = cells.bottom; y <= cells.top; y++)
+			{
+				auto fnd = mCells.find(GetCellKey(x, y));
+				if (fnd != mCells.end())
+					processCell(fnd->second);
+			}
+		}
+	}
+}
@@ -0,0 +1,162 @@
+#include "o2/stdafx.h"
+#include "TransformHierarchyStore.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorTransform.h"
+#include "o2/Utils/System/Time/Time.h"
+
+namespace o2
+{
+	void TransformHierarchyStore::SetHierarchyChanged()
+	{
+		mHierarchyChanged = true;
+	}
+
+	void TransformHierarchyStore::Update(const Vector<Actor*>& rootActors)
+	{
+		bool fullUpdate = mHierarchyChanged;
+		if (mHierarchyChanged)
+			Rebuild(rootActors);
+
+		mUpdatedCount = 0;
+
+		int count = mTransforms.Count();
+		for (int i = 0; i < count; i++)
+		{
+			ActorTransform* transform = mTransforms[i];
+			ActorTransformData* data = transform->mData;
+			int parentIdx = mParents[i];
+
+			bool selfDirty = fullUpdate || transform->IsDirty();
+			bool parentUpdated = parentIdx >= 0 && mUpdated[parentIdx];
+
+			if (!selfDirty && !parentUpdated)
+			{
+				mUpdated[i] = 0;
+				continue;
+			}
+
+			if (selfDirty)
+			{
+				transform->UpdateRectangle();
+				transform->UpdateTransform();
+
+				mLocalRects[i] = data->rectangle;
+				mLocalBases[i] = data->transform;
+				mLocalNonSizedBases[i] = data->nonSizedTransform;
+				mPivotOffsets[i] = data->size*data->pivot;
+			}
+
+			const RectF& localRect = mLocalRects[i];
+
+			if (parentIdx >= 0)
+			{
+				data->parentRectangle = mWorldRects[parentIdx];
+				data->parentRectangePosition = data->parentRectangle.LeftBottom() + mPivotOffsets[parentIdx];
+				data->parentTransform = mWorldNonSizedBases[parentIdx];
+			}
+			else
+			{
+				data->parentRectangle = RectF();
+				data->parentRectangePosition = Vec2F();
+				data->parentTransform = Basis::Identity();
+			}
+
+			RectF& worldRect = mWorldRects[i];
+			worldRect.left   = data->parentRectangePosition.x + localRect.left;
+			worldRect.right  = data->parentRectangePosition.x + localRect.right;
+			worldRect.bottom = data->parentRectangePosition.y + localRect.bottom;
+			worldRect.top    = data->parentRectangePosition.y + localRect.top;
+
+			mWorldNonSizedBases[i] = mLocalNonSizedBases[i]*data->parentTransform;
+			mWorldBases[i] = mLocalBases[i]*data->parentTransform;
+
+			data->worldRectangle = worldRect;
+			data->worldNonSizedTransform = mWorldNonSizedBases[i];
+			data->worldTransform = mWorldBases[i];
+
+			if (!selfDirty)
+				data->dirtyFrame = o2Time.GetCurrentFrame();
+
+			data->updateFrame = data->dirtyFrame;
+			mUpdated[i] = 1;
+			mUpdatedCount++;
+
+			// Children with other transform types are updated by actors, they must know parent was changed
+			for (auto child : data->owner->GetChildren())
+			{
+				if (!IsStorable(child))
+					child->transform->SetDirty(true);
+			}
+
+			data->owner->OnTransformUpdated();
+		}
+	}
+
+	int TransformHierarchyStore::GetCount() const
+	{
+		return mTransforms.Count();
+	}
+
+	int TransformHierarchyStore::GetUpdatedCount() const
+	{
+		return mUpdatedCount;
+	}
+
+	void TransformHierarchyStore::Clear()
+	{
+		mTransforms.Clear();
+		mParents.Clear();
+		mLocalBases.Clear();
+		mLocalNonSizedBases.Clear();
+		mLocalRects.Clear();
+		mPivotOffsets.Clear();
+		mWorldBases.Clear();
+		mWorldNonSizedBases.Clear();
+		mWorldRects.Clear();
+		mUpdated.Clear();
+
+		mHierarchyChanged = true;
+	}
+
+	void TransformHierarchyStore::Rebuild(const Vector<Actor*>& rootActors)
+	{
+		Clear();
+
+		for (auto actor : rootActors)
+		{
+			if (IsStorable(actor))
+				Add(actor, -1);
+		}
+
+		int count = mTransforms.Count();
+		mLocalBases.Resize(count);
+		mLocalNonSizedBases.Resize(count);
+		mLocalRects.Resize(count);
+		mPivotOffsets.Resize(count);
+		mWorldBases.Resize(count);
+		mWorldNonSizedBases.Resize(count);
+		mWorldRects.Resize(count);
+		mUpdated.Resize(count);
+
+		mHierarchyChanged = false;
+	}
+
+	void TransformHierarchyStore::Add(Actor* actor, int parentIdx)
+	{
+		int idx = mTransforms.Count();
+		mTransforms.Add(actor->transform);
+		mParents.Add(parentIdx);
+
+		for (auto child : actor->GetChildren())
+		{
+			if (IsStorable(child))
+				Add(child, idx);
+		}
+	}
+
+	bool TransformHierarchyStore::IsStorable(Actor* actor)
+	{
+		return actor->transform->GetType() == TypeOf(ActorTransform);
+	}
+}
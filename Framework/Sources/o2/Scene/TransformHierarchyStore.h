@@ -0,0 +1,67 @@
+#pragma once
+
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Actor;
+	class ActorTransform;
+
+	// ------------------------------------------------------------------------------------------------------
+	// Flattened scene transforms hierarchy. Stores actors with plain ActorTransform in contiguous arrays in
+	// topological order: parent is always before children. Dirty transforms and their subtrees are updated
+	// in one linear pass; parent's world data is taken from arrays instead of walking actors. Results are
+	// written back into transforms data, so ActorTransform getters read updated values.
+	// Actors with other transform types (widget layouts) and their subtrees are updated by actors as before
+	// ------------------------------------------------------------------------------------------------------
+	class TransformHierarchyStore
+	{
+	public:
+		// Marks hierarchy as changed, arrays will be rebuilt before next update
+		void SetHierarchyChanged();
+
+		// Rebuilds arrays when hierarchy was changed and updates dirty transforms subtrees
+		void Update(const Vector<Actor*>& rootActors);
+
+		// Returns count of stored transforms
+		int GetCount() const;
+
+		// Returns count of transforms updated in last pass
+		int GetUpdatedCount() const;
+
+		// Removes all transforms
+		void Clear();
+
+	protected:
+		Vector<ActorTransform*> mTransforms; // Stored transforms in topological order
+		Vector<int>             mParents;    // Parent index for each transform, -1 for root
+
+		Vector<Basis> mLocalBases;         // Local sized bases
+		Vector<Basis> mLocalNonSizedBases; // Local bases without size
+		Vector<RectF> mLocalRects;         // Local rectangles
+		Vector<Vec2F> mPivotOffsets;       // Pivot offsets from left bottom corner, used by children
+
+		Vector<Basis> mWorldBases;         // World sized bases
+		Vector<Basis> mWorldNonSizedBases; // World bases without size
+		Vector<RectF> mWorldRects;         // World rectangles
+
+		Vector<UInt8> mUpdated; // Is transform updated in current pass
+
+		bool mHierarchyChanged = true; // Is hierarchy changed and arrays must be rebuilt
+		int  mUpdatedCount = 0;        // Count of transforms updated in last pass
+
+	protected:
+		// Rebuilds arrays from actors hierarchy
+		void Rebuild(const Vector<Actor*>& rootActors);
+
+		// Adds actor and its children with plain transforms into arrays
+		void Add(Actor* actor, int parentIdx);
+
+		// Returns true when actor's transform can be stored: it's plain ActorTransform
+		static bool IsStorable(Actor* actor);
+	};
+}
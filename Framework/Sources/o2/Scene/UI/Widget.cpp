@@ -332,6 +332,11 @@ namespace o2
 		return mResEnabledInHierarchy;
 	}
 
+	Actor* Widget::GetSceneDrawableActor() const
+	{
+		return const_cast<Widget*>(this);
+	}
+
 	void Widget::OnFocused()
 	{
 		onFocused();
@@ -316,6 +316,9 @@ namespace o2
 		// Returns is drawable enabled
 		bool IsSceneDrawableEnabled() const override;
 
+		// Returns this widget as drawable owner
+		Actor* GetSceneDrawableActor() const override;
+
 		// Updates child widgets list
 		void UpdateChildWidgetsList();
 
@@ -811,6 +814,7 @@ CLASS_METHODS_META(o2::Widget)
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(Actor*, GetSceneDrawableActor);
 	PROTECTED_FUNCTION(void, UpdateChildWidgetsList);
 	PROTECTED_FUNCTION(WidgetLayoutData&, GetLayoutData);
 	PROTECTED_FUNCTION(const WidgetLayoutData&, GetLayoutData);
@@ -50,7 +50,7 @@ namespace o2
 
 	void WidgetState::SetAnimationClip(const AnimationClip& animation)
 	{
-		if (mAnimation && mAnimation.IsInstance())
+		if (mAnimation && mAnimation.IsInstance() && mAnimation.GetReferencesCount() <= 1)
 			mAnimation->animation = animation;
 		else
 		{
@@ -59,7 +59,7 @@ namespace o2
 		}
 	}
 
-	AnimationClip& WidgetState::GetAnimationClip()
+	const AnimationClip& WidgetState::GetAnimationClip() const
 	{
 		if (mAnimation)
 			return mAnimation->animation;
@@ -68,6 +68,22 @@ namespace o2
 		return empty;
 	}
 
+	AnimationClip& WidgetState::GetEditableAnimationClip()
+	{
+		if (!mAnimation)
+		{
+			mAnimation = AnimationAssetRef(mnew AnimationAsset());
+			player.SetClip(&mAnimation->animation);
+		}
+		else if (mAnimation.IsInstance() && mAnimation.GetReferencesCount() > 1)
+		{
+			mAnimation = AnimationAssetRef(mnew AnimationAsset(mAnimation->animation));
+			player.SetClip(&mAnimation->animation);
+		}
+
+		return mAnimation->animation;
+	}
+
 	void WidgetState::SetState(bool state)
 	{
  		if (mState == state && !player.IsPlaying())
@@ -62,11 +62,15 @@ namespace o2
 		// Returns animation asset
 		const AnimationAssetRef& GetAnimationAsset() const;
 
-		// Sets animation asset instance clip
+		// Sets animation asset instance clip. Clip shared with other states is not changed, new instance is created
 		void SetAnimationClip(const AnimationClip& animation);
 
-		// Returns animation asset instance clip, if exists
-		AnimationClip& GetAnimationClip();
+		// Returns animation clip, if exists. Clip can be shared between copies of state, so it is immutable
+		const AnimationClip& GetAnimationClip() const;
+
+		// Returns animation clip for editing. When asset instance clip is shared with other states, it is copied
+		// into own instance before, so changes don't affect other states
+		AnimationClip& GetEditableAnimationClip();
 
 		// Sets current state
 		void SetState(bool state);
@@ -128,7 +132,8 @@ CLASS_METHODS_META(o2::WidgetState)
 	PUBLIC_FUNCTION(void, SetAnimationAsset, const AnimationAssetRef&);
 	PUBLIC_FUNCTION(const AnimationAssetRef&, GetAnimationAsset);
 	PUBLIC_FUNCTION(void, SetAnimationClip, const AnimationClip&);
-	PUBLIC_FUNCTION(AnimationClip&, GetAnimationClip);
+	PUBLIC_FUNCTION(const AnimationClip&, GetAnimationClip);
+	PUBLIC_FUNCTION(AnimationClip&, GetEditableAnimationClip);
 	PUBLIC_FUNCTION(void, SetState, bool);
 	PUBLIC_FUNCTION(void, SetStateForcible, bool);
 	PUBLIC_FUNCTION(bool, GetState);
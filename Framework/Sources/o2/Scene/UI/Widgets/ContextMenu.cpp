@@ -704,7 +704,7 @@ namespace o2
 
 	void ContextMenu::RebuildItems()
 	{
-		PushEditorScopeOnStack scope(IEventsListener::mIsEditorMode ? 1 : 0);
+		PushEditorScopeOnStack scope(CursorAreaEventsListener::mIsEditorMode ? 1 : 0);
 
 		Vector<ContextMenuItem*> cache;
 
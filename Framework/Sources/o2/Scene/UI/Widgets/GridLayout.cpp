@@ -2,6 +2,7 @@
 #include "GridLayout.h"
 
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -192,6 +193,8 @@ namespace o2
 
 	void GridLayout::RearrangeChilds()
 	{
+		PROFILE_SCOPE("UI layout rearrange");
+
 		switch (mBaseCorner)
 		{
 			case BaseCorner::LeftTop: ArrangeFromLeftTop(); break;
@@ -2,6 +2,7 @@
 #include "HorizontalLayout.h"
 
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -230,6 +231,8 @@ namespace o2
 
 	void HorizontalLayout::RearrangeChilds()
 	{
+		PROFILE_SCOPE("UI layout rearrange");
+
 		UpdateLayoutParametres();
 
 		switch (mBaseCorner)
@@ -3,6 +3,7 @@
 
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -232,6 +233,8 @@ namespace o2
 
 	void VerticalLayout::RearrangeChilds()
 	{
+		PROFILE_SCOPE("UI layout rearrange");
+
 		switch (mBaseCorner)
 		{
 			case BaseCorner::LeftTop:
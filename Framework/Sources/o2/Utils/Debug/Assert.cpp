@@ -16,6 +16,8 @@ namespace o2
 
 #ifdef PLATFORM_WINDOWS
 		MessageBox(nullptr, message, "Error", MB_OK | MB_ICONERROR | MB_TASKMODAL);
+#elif defined PLATFORM_LINUX
+		fprintf(stderr, "%s\n", message);
 #endif
 	}
 }
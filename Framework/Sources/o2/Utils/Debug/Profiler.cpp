@@ -0,0 +1,349 @@
+#include "o2/stdafx.h"
+#include "Profiler.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Text.h"
+#include "o2/Render/VectorFont.h"
+#include "o2/Utils/FileSystem/File.h"
+
+namespace o2
+{
+	CREATE_SINGLETON(Profiler);
+
+	static thread_local UInt profilerThreadIndex = (UInt)-1; // Index of current thread in profiler, -1 if not indexed yet
+	static thread_local int  profilerScopeDepth = 0;         // Current depth of opened scopes in current thread
+
+	Profiler::Profiler():
+		mStartTime(Clock::now()), mThreadsCount(0)
+	{
+		GetCurrentThreadIndex();
+	}
+
+	Profiler::~Profiler()
+	{
+		delete mOverlayText;
+		delete mOverlayFont;
+	}
+
+	void Profiler::SetEnabled(bool enabled)
+	{
+		mEnabled = enabled;
+	}
+
+	bool Profiler::IsEnabled() const
+	{
+		return mEnabled;
+	}
+
+	void Profiler::SetOverlayEnabled(bool enabled)
+	{
+		mOverlayEnabled = enabled;
+	}
+
+	bool Profiler::IsOverlayEnabled() const
+	{
+		return mOverlayEnabled;
+	}
+
+	void Profiler::SetHistoryFramesCount(int count)
+	{
+		mHistoryFramesCount = Math::Max(count, 1);
+
+		if (mFrames.Count() > mHistoryFramesCount)
+			mFrames.erase(mFrames.begin(), mFrames.begin() + (mFrames.Count() - mHistoryFramesCount));
+	}
+
+	int Profiler::GetHistoryFramesCount() const
+	{
+		return mHistoryFramesCount;
+	}
+
+	void Profiler::SetMaxFrameSamples(int count)
+	{
+		mMaxFrameSamples = Math::Max(count, 0);
+	}
+
+	int Profiler::GetMaxFrameSamples() const
+	{
+		return mMaxFrameSamples;
+	}
+
+	void Profiler::SetFrameBudget(float milliseconds)
+	{
+		mFrameBudget = Math::Max(milliseconds, 0.001f);
+	}
+
+	float Profiler::GetFrameBudget() const
+	{
+		return mFrameBudget;
+	}
+
+	void Profiler::BeginFrame()
+	{
+		if (!mEnabled)
+			return;
+
+		std::lock_guard<std::mutex> lock(mSamplesMutex);
+
+		mCurrentFrame.index = mFrameIndex++;
+		mCurrentFrame.begin = GetTime();
+		mCurrentFrame.samples.Clear();
+		mCurrentFrame.droppedSamples = 0;
+
+		mFrameStarted = true;
+	}
+
+	void Profiler::EndFrame()
+	{
+		if (!mFrameStarted)
+			return;
+
+		std::lock_guard<std::mutex> lock(mSamplesMutex);
+
+		mFrameStarted = false;
+		mCurrentFrame.end = GetTime();
+
+		if (mFrames.Count() >= mHistoryFramesCount)
+		{
+			// Reuse oldest frame samples buffer for next frame
+			Frame oldest = std::move(mFrames[0]);
+			mFrames.erase(mFrames.begin());
+			mFrames.Add(std::move(mCurrentFrame));
+			mCurrentFrame = std::move(oldest);
+		}
+		else
+		{
+			mFrames.Add(std::move(mCurrentFrame));
+			mCurrentFrame = Frame();
+		}
+	}
+
+	const Vector<Profiler::Frame>& Profiler::GetFrames() const
+	{
+		return mFrames;
+	}
+
+	const Profiler::Frame* Profiler::GetLastFrame() const
+	{
+		if (mFrames.IsEmpty())
+			return nullptr;
+
+		return &mFrames.Last();
+	}
+
+	void Profiler::ClearFrames()
+	{
+		std::lock_guard<std::mutex> lock(mSamplesMutex);
+		mFrames.Clear();
+	}
+
+	// Writes string into JSON string with escaping
+	static void WriteJsonString(String& out, const char* str)
+	{
+		out += '"';
+
+		for (const char* c = str; *c; c++)
+		{
+			if (*c == '"' || *c == '\\')
+				out += '\\';
+
+			if ((unsigned char)*c < 0x20)
+				continue;
+
+			out += *c;
+		}
+
+		out += '"';
+	}
+
+	String Profiler::GetChromeTrace() const
+	{
+		String res;
+		res.Reserve(1024 + mFrames.Sum<int>([](const Frame& frame) { return (frame.samples.Count() + 1)*96; }));
+
+		res += "{\"traceEvents\":[\n";
+
+		bool first = true;
+		for (auto& frame : mFrames)
+		{
+			if (!first)
+				res += ",\n";
+
+			first = false;
+
+			res += String::Format("{\"name\":\"Frame %i\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":0}",
+								  (int)frame.index, frame.begin, frame.end - frame.begin);
+
+			for (auto& sample : frame.samples)
+			{
+				res += ",\n{\"name\":";
+				WriteJsonString(res, sample.name);
+				res += String::Format(",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%i}",
+									  sample.begin, sample.end - sample.begin, (int)sample.thread);
+			}
+		}
+
+		res += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+		return res;
+	}
+
+	bool Profiler::SaveChromeTrace(const String& path) const
+	{
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		String trace = GetChromeTrace();
+		file.WriteData(trace.Data(), trace.Length());
+
+		return true;
+	}
+
+	void Profiler::DrawOverlay()
+	{
+		const Frame* frame = GetLastFrame();
+		if (!frame)
+			return;
+
+		if (!mOverlayText)
+		{
+			mOverlayFont = mnew VectorFont(o2Assets.GetBuiltAssetsPath() + "debugFont.ttf");
+			mOverlayText = mnew Text(FontRef(mOverlayFont));
+			mOverlayText->SetHeight(12);
+			mOverlayText->SetHorAlign(HorAlign::Left);
+			mOverlayText->SetVerAlign(VerAlign::Top);
+		}
+
+		Camera prevCamera = o2Render.GetCamera();
+		o2Render.SetCamera(Camera::Default());
+
+		// Summary durations of main thread first and second levels samples by name, in order of first appearance
+		struct Line
+		{
+			const char* name;
+			int         depth;
+			double      duration;
+			double      begin;
+		};
+
+		Vector<Line> lines;
+		for (auto& sample : frame->samples)
+		{
+			if (sample.thread != 0 || sample.depth > 1)
+				continue;
+
+			Line* line = lines.Find([&](const Line& x) { return x.name == sample.name && x.depth == sample.depth; });
+			if (line)
+				line->duration += sample.end - sample.begin;
+			else
+				lines.Add({ sample.name, sample.depth, sample.end - sample.begin, sample.begin });
+		}
+
+		lines.Sort([](const Line& a, const Line& b) { return a.begin < b.begin; });
+
+		const float lineHeight = 16.0f, barWidth = 200.0f, textWidth = 300.0f;
+		Vec2F resolution = (Vec2F)o2Render.GetResolution();
+		Vec2F origin(-resolution.x*0.5f + 10.0f, resolution.y*0.5f - 10.0f);
+
+		auto drawLine = [&](const String& caption, double durationMs, float indent, const Color4& color)
+		{
+			float barLength = Math::Min((float)(durationMs/mFrameBudget), 1.0f)*barWidth;
+			Vec2F barOrigin(origin.x + textWidth, origin.y - lineHeight + 3.0f);
+
+			o2Render.DrawFilledPolygon({ barOrigin, barOrigin + Vec2F(0, lineHeight - 4.0f),
+									   barOrigin + Vec2F(barLength, lineHeight - 4.0f), barOrigin + Vec2F(barLength, 0) },
+									   color);
+
+			mOverlayText->SetRect(RectF(origin.x + indent, origin.y, origin.x + textWidth, origin.y - lineHeight));
+			mOverlayText->SetText(caption + String::Format(": %.2f ms", (float)durationMs));
+			mOverlayText->Draw();
+
+			origin.y -= lineHeight;
+		};
+
+		double frameMs = frame->GetDurationMs();
+		drawLine(String::Format("Frame %i", (int)frame->index), frameMs,
+				 0.0f, frameMs > mFrameBudget ? Color4(255, 80, 80, 200) : Color4(80, 255, 80, 200));
+
+		for (auto& line : lines)
+			drawLine(line.name, line.duration/1000.0, 10.0f + line.depth*10.0f, Color4(100, 160, 255, 200));
+
+		o2Render.SetCamera(prevCamera);
+	}
+
+	double Profiler::GetTime() const
+	{
+		return std::chrono::duration<double, std::micro>(Clock::now() - mStartTime).count();
+	}
+
+	void Profiler::AddSample(const char* name, double begin, double end, int depth)
+	{
+		UInt thread = GetCurrentThreadIndex();
+
+		std::lock_guard<std::mutex> lock(mSamplesMutex);
+
+		if (!mFrameStarted)
+			return;
+
+		if (mCurrentFrame.samples.Count() >= mMaxFrameSamples)
+		{
+			mCurrentFrame.droppedSamples++;
+			return;
+		}
+
+		Sample sample;
+		sample.name = name;
+		sample.begin = begin;
+		sample.end = end;
+		sample.depth = depth;
+		sample.thread = thread;
+
+		mCurrentFrame.samples.Add(sample);
+	}
+
+	UInt Profiler::GetCurrentThreadIndex()
+	{
+		if (profilerThreadIndex == (UInt)-1)
+		{
+			std::lock_guard<std::mutex> lock(mSamplesMutex);
+			profilerThreadIndex = mThreadsCount++;
+		}
+
+		return profilerThreadIndex;
+	}
+
+	double Profiler::Sample::GetDurationMs() const
+	{
+		return (end - begin)/1000.0;
+	}
+
+	double Profiler::Frame::GetDurationMs() const
+	{
+		return (end - begin)/1000.0;
+	}
+
+	Profiler::Scope::Scope(const char* name):
+		mName(name), mValid(false)
+	{
+		Profiler* profiler = Profiler::InstancePtr();
+		if (!profiler || !profiler->mFrameStarted)
+			return;
+
+		mValid = true;
+		mBegin = profiler->GetTime();
+		profilerScopeDepth++;
+	}
+
+	Profiler::Scope::~Scope()
+	{
+		if (!mValid)
+			return;
+
+		profilerScopeDepth--;
+
+		Profiler* profiler = Profiler::InstancePtr();
+		profiler->AddSample(mName, mBegin, profiler->GetTime(), profilerScopeDepth);
+	}
+}
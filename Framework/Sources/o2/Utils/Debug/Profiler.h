@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include "o2/EngineSettings.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+// Profiler access macros
+#define o2Profiler o2::Profiler::Instance()
+
+#if PROFILER_ENABLED
+
+#define PROFILER_CONCAT_IMPL(A, B) A##B
+#define PROFILER_CONCAT(A, B) PROFILER_CONCAT_IMPL(A, B)
+
+// Profiles current scope with name. Name must be string literal or other string with static lifetime
+#define PROFILE_SCOPE(NAME) o2::Profiler::Scope PROFILER_CONCAT(__profilerScope, __LINE__)(NAME)
+
+// Profiles current function scope
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+
+#else
+
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_FUNCTION()
+
+#endif
+
+namespace o2
+{
+	class Text;
+	class VectorFont;
+
+	// -------------------------------------------------------------------------------------------
+	// Frame profiler. Collects hierarchical CPU time samples of named scopes for last frames.
+	// Samples are collected between BeginFrame() and EndFrame() from any thread. Last frame can be
+	// drawn as overlay, collected frames can be exported into Chrome trace JSON (chrome://tracing)
+	// -------------------------------------------------------------------------------------------
+	class Profiler: public Singleton<Profiler>
+	{
+	public:
+		// -----------------------------------------------------------------------------
+		// Profiling sample. Times are in microseconds from profiler creation
+		// -----------------------------------------------------------------------------
+		struct Sample
+		{
+			const char* name = nullptr; // Scope name
+			double      begin = 0.0;    // Scope begin time
+			double      end = 0.0;      // Scope end time
+			int         depth = 0;      // Depth of scope in thread scopes hierarchy
+			UInt        thread = 0;     // Thread index, main thread is 0
+
+		public:
+			// Returns sample duration in milliseconds
+			double GetDurationMs() const;
+		};
+
+		// ----------------------------------------
+		// Profiled frame with collected samples
+		// ----------------------------------------
+		struct Frame
+		{
+			UInt64         index = 0;          // Frame index
+			double         begin = 0.0;        // Frame begin time in microseconds
+			double         end = 0.0;          // Frame end time in microseconds
+			Vector<Sample> samples;            // Frame samples, sorted by end time
+			UInt           droppedSamples = 0; // Count of samples didn't fit into samples limit
+
+		public:
+			// Returns frame duration in milliseconds
+			double GetDurationMs() const;
+		};
+
+		// ---------------------------------------------------------------------
+		// Scoped sample. Begins sample in constructor and ends in destructor
+		// ---------------------------------------------------------------------
+		class Scope
+		{
+		public:
+			// Constructor, begins sample
+			Scope(const char* name);
+
+			// Destructor, ends sample
+			~Scope();
+
+		private:
+			const char* mName;  // Sample name
+			double      mBegin; // Sample begin time
+			bool        mValid; // True when sample is collecting
+		};
+
+	public:
+		// Default constructor
+		Profiler();
+
+		// Destructor
+		~Profiler();
+
+		// Enables or disables samples collecting
+		void SetEnabled(bool enabled);
+
+		// Returns true when samples are collecting
+		bool IsEnabled() const;
+
+		// Enables or disables last frame overlay drawing
+		void SetOverlayEnabled(bool enabled);
+
+		// Returns true when last frame overlay is drawing
+		bool IsOverlayEnabled() const;
+
+		// Sets count of stored last frames
+		void SetHistoryFramesCount(int count);
+
+		// Returns count of stored last frames
+		int GetHistoryFramesCount() const;
+
+		// Sets maximum samples count in frame. Other samples are dropped
+		void SetMaxFrameSamples(int count);
+
+		// Returns maximum samples count in frame
+		int GetMaxFrameSamples() const;
+
+		// Sets frame time budget in milliseconds, used for overlay bars scale
+		void SetFrameBudget(float milliseconds);
+
+		// Returns frame time budget in milliseconds
+		float GetFrameBudget() const;
+
+		// Begins new frame. Called by application before frame processing
+		void BeginFrame();
+
+		// Ends frame and stores it in history. Called by application after frame processing
+		void EndFrame();
+
+		// Returns stored frames, oldest first
+		const Vector<Frame>& GetFrames() const;
+
+		// Returns last finished frame, or nullptr if there is no finished frames
+		const Frame* GetLastFrame() const;
+
+		// Removes all stored frames
+		void ClearFrames();
+
+		// Returns stored frames samples in Chrome trace JSON format
+		String GetChromeTrace() const;
+
+		// Saves stored frames samples in Chrome trace JSON format into file. Returns false if file can't be written
+		bool SaveChromeTrace(const String& path) const;
+
+		// Draws last frame samples overlay with default camera
+		void DrawOverlay();
+
+		// Returns current time in microseconds from profiler creation
+		double GetTime() const;
+
+	protected:
+		typedef std::chrono::high_resolution_clock Clock;
+
+		Clock::time_point mStartTime; // Profiler creation time
+
+		bool  mEnabled = true;           // True when samples are collecting
+		bool  mOverlayEnabled = false;   // True when overlay is drawing
+		int   mHistoryFramesCount = 300; // Count of stored last frames
+		int   mMaxFrameSamples = 65536;  // Maximum samples in frame
+		float mFrameBudget = 1000.0f/60.0f; // Frame time budget in milliseconds
+
+		std::atomic<bool> mFrameStarted{ false }; // True between BeginFrame() and EndFrame(). Read by scopes in any thread
+		UInt64            mFrameIndex = 0;          // Current frame index
+		Frame             mCurrentFrame;            // Collecting frame
+		Vector<Frame>     mFrames;                  // Stored last frames
+
+		std::mutex mSamplesMutex; // Samples adding mutex, scopes can be ended in any thread
+		UInt       mThreadsCount; // Count of threads, that were sampled; used for threads indexing
+
+		VectorFont* mOverlayFont = nullptr; // Overlay captions font
+		Text*       mOverlayText = nullptr; // Overlay captions text
+
+	protected:
+		// Adds finished sample into current frame
+		void AddSample(const char* name, double begin, double end, int depth);
+
+		// Returns current thread index. Main thread, that created profiler, is 0
+		UInt GetCurrentThreadIndex();
+
+		friend class Scope;
+	};
+}
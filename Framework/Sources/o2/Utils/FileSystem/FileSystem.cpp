@@ -4,6 +4,7 @@
 #include "o2/Application/Application.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Tools/Hash.h"
 
 namespace o2
 {
@@ -69,4 +70,18 @@ namespace o2
 		OutFile file(path);
 		file.WriteData(data.Data(), data.Length());
 	}
+
+	UInt64 FileSystem::GetFileHash(const String& path)
+	{
+		InFile file(path);
+		if (!file.IsOpened())
+			return 0;
+
+		UInt size = file.GetDataSize();
+		Vector<char> data;
+		data.Resize(size);
+		file.ReadFullData(data.Data());
+
+		return GetFNV1aHash(data.Data(), size);
+	}
 }
@@ -98,6 +98,9 @@ namespace o2
 		// Writes file data
 		static void WriteFile(const String& path, const String& data);
 
+		// Returns 64 bit FNV-1a hash of file content, zero when file can't be read
+		static UInt64 GetFileHash(const String& path);
+
 	private:
 		LogStream* mLog; // File system log stream
 	};
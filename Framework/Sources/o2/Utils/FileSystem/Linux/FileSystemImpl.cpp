@@ -0,0 +1,338 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Log/LogStream.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace o2
+{
+	// Converts POSIX time to local time stamp
+	static TimeStamp ConvertToTimeStamp(time_t time)
+	{
+		struct tm local;
+		localtime_r(&time, &local);
+
+		return TimeStamp(local.tm_sec, local.tm_min, local.tm_hour, local.tm_mday, local.tm_mon + 1, local.tm_year + 1900);
+	}
+
+	// Splits path into parts without empty parts and "." parts
+	static Vector<String> SplitPath(const String& path)
+	{
+		Vector<String> res;
+
+		String normalized = path.ReplacedAll("\\", "/");
+		for (auto& part : normalized.Split("/"))
+		{
+			if (part.IsEmpty() || part == ".")
+				continue;
+
+			res.Add(part);
+		}
+
+		return res;
+	}
+
+	FolderInfo FileSystem::GetFolderInfo(const String& path) const
+	{
+		FolderInfo res;
+		res.path = path;
+
+		DIR* dir = opendir(path.Data());
+		if (!dir)
+		{
+			mInstance->mLog->Error("Failed GetPathInfo: Error opening directory " + path);
+			return res;
+		}
+
+		while (dirent* entry = readdir(dir))
+		{
+			if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+				continue;
+
+			String entryPath = path + "/" + entry->d_name;
+
+			if (IsFolderExist(entryPath))
+				res.folders.Add(GetFolderInfo(entryPath));
+			else
+				res.files.Add(GetFileInfo(entryPath));
+		}
+
+		closedir(dir);
+
+		return res;
+	}
+
+	bool FileSystem::FileCopy(const String& source, const String& dest) const
+	{
+		FileDelete(dest);
+		FolderCreate(ExtractPathStr(dest));
+
+		int sourceFile = open(source.Data(), O_RDONLY);
+		if (sourceFile < 0)
+			return false;
+
+		int destFile = open(dest.Data(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (destFile < 0)
+		{
+			close(sourceFile);
+			return false;
+		}
+
+		char buffer[64*1024];
+		bool success = true;
+		ssize_t readBytes;
+
+		while ((readBytes = read(sourceFile, buffer, sizeof(buffer))) > 0)
+		{
+			if (write(destFile, buffer, readBytes) != readBytes)
+			{
+				success = false;
+				break;
+			}
+		}
+
+		if (readBytes < 0)
+			success = false;
+
+		close(sourceFile);
+		close(destFile);
+
+		return success;
+	}
+
+	bool FileSystem::FileDelete(const String& file) const
+	{
+		return unlink(file.Data()) == 0;
+	}
+
+	bool FileSystem::FileMove(const String& source, const String& dest) const
+	{
+		String destFolder = GetParentPath(dest);
+
+		if (!destFolder.IsEmpty() && !IsFolderExist(destFolder))
+			FolderCreate(destFolder);
+
+		if (rename(source.Data(), dest.Data()) == 0)
+			return true;
+
+		// Rename doesn't work between different file systems
+		if (!FileCopy(source, dest))
+			return false;
+
+		return FileDelete(source);
+	}
+
+	FileInfo FileSystem::GetFileInfo(const String& path) const
+	{
+		FileInfo res;
+		res.path = "invalid_file";
+
+		struct stat fileStat;
+		if (stat(path.Data(), &fileStat) != 0)
+			return res;
+
+		res.createdDate = ConvertToTimeStamp(fileStat.st_ctime);
+		res.accessDate = ConvertToTimeStamp(fileStat.st_atime);
+		res.editDate = ConvertToTimeStamp(fileStat.st_mtime);
+
+		res.path = path;
+		res.size = (Int64)fileStat.st_size;
+
+		return res;
+	}
+
+	bool FileSystem::SetFileEditDate(const String& path, const TimeStamp& time) const
+	{
+		struct tm local;
+		memset(&local, 0, sizeof(local));
+
+		local.tm_sec = time.mSecond;
+		local.tm_min = time.mMinute;
+		local.tm_hour = time.mHour;
+		local.tm_mday = time.mDay;
+		local.tm_mon = time.mMonth - 1;
+		local.tm_year = time.mYear - 1900;
+		local.tm_isdst = -1;
+
+		struct timespec times[2];
+		times[0].tv_sec = 0;
+		times[0].tv_nsec = UTIME_OMIT;
+		times[1].tv_sec = mktime(&local);
+		times[1].tv_nsec = 0;
+
+		return utimensat(AT_FDCWD, path.Data(), times, 0) == 0;
+	}
+
+	bool FileSystem::FolderCreate(const String& path, bool recursive /*= true*/) const
+	{
+		if (IsFolderExist(path))
+			return true;
+
+		if (!recursive)
+			return mkdir(path.Data(), 0755) == 0;
+
+		if (mkdir(path.Data(), 0755) == 0)
+			return true;
+
+		String extrPath = ExtractPathStr(path);
+		if (extrPath == path || extrPath.IsEmpty())
+			return false;
+
+		if (!FolderCreate(extrPath, true))
+			return false;
+
+		return mkdir(path.Data(), 0755) == 0;
+	}
+
+	bool FileSystem::FolderCopy(const String& from, const String& to) const
+	{
+		if (!IsFolderExist(from) || !IsFolderExist(to))
+			return false;
+
+		String destPath = to + "/" + GetPathWithoutDirectories(from);
+		if (!FolderCreate(destPath))
+			return false;
+
+		DIR* dir = opendir(from.Data());
+		if (!dir)
+			return false;
+
+		bool success = true;
+		while (dirent* entry = readdir(dir))
+		{
+			if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+				continue;
+
+			String entryPath = from + "/" + entry->d_name;
+
+			if (IsFolderExist(entryPath))
+				success = FolderCopy(entryPath, destPath) && success;
+			else
+				success = FileCopy(entryPath, destPath + "/" + entry->d_name) && success;
+		}
+
+		closedir(dir);
+
+		return success;
+	}
+
+	bool FileSystem::FolderRemove(const String& path, bool recursive /*= true*/) const
+	{
+		if (!IsFolderExist(path))
+			return false;
+
+		if (!recursive)
+			return rmdir(path.Data()) == 0;
+
+		DIR* dir = opendir(path.Data());
+		if (dir)
+		{
+			while (dirent* entry = readdir(dir))
+			{
+				if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+					continue;
+
+				String entryPath = path + "/" + entry->d_name;
+
+				if (IsFolderExist(entryPath))
+					FolderRemove(entryPath, true);
+				else
+					FileDelete(entryPath);
+			}
+
+			closedir(dir);
+		}
+
+		return rmdir(path.Data()) == 0;
+	}
+
+	bool FileSystem::Rename(const String& old, const String& newPath) const
+	{
+		int res = rename(old, newPath);
+		return res == 0;
+	}
+
+	bool FileSystem::IsFolderExist(const String& path) const
+	{
+		struct stat pathStat;
+		if (stat(path.Data(), &pathStat) != 0)
+			return false;
+
+		return S_ISDIR(pathStat.st_mode);
+	}
+
+	bool FileSystem::IsFileExist(const String& path) const
+	{
+		struct stat pathStat;
+		if (stat(path.Data(), &pathStat) != 0)
+			return false;
+
+		return !S_ISDIR(pathStat.st_mode);
+	}
+
+	String FileSystem::GetPathRelativeToPath(const String& from, const String& to)
+	{
+		Vector<String> fromParts = SplitPath(CanonicalizePath(from));
+		Vector<String> toParts = SplitPath(CanonicalizePath(to));
+
+		int commonParts = 0;
+		while (commonParts < fromParts.Count() && commonParts < toParts.Count() &&
+			   fromParts[commonParts] == toParts[commonParts])
+		{
+			commonParts++;
+		}
+
+		String res;
+		for (int i = commonParts; i < fromParts.Count(); i++)
+			res += "../";
+
+		if (res.IsEmpty())
+			res = "./";
+
+		for (int i = commonParts; i < toParts.Count(); i++)
+		{
+			res += toParts[i];
+
+			if (i < toParts.Count() - 1)
+				res += "/";
+		}
+
+		return res;
+	}
+
+	String FileSystem::CanonicalizePath(const String& path)
+	{
+		bool absolute = path.StartsWith("/");
+
+		Vector<String> resParts;
+		for (auto& part : SplitPath(path))
+		{
+			if (part == ".." && !resParts.IsEmpty() && resParts.Last() != "..")
+				resParts.PopBack();
+			else if (part != ".." || !absolute)
+				resParts.Add(part);
+		}
+
+		String res = absolute ? "/" : "";
+		for (int i = 0; i < resParts.Count(); i++)
+		{
+			res += resParts[i];
+
+			if (i < resParts.Count() - 1)
+				res += "/";
+		}
+
+		return res;
+	}
+}
+
+#endif // PLATFORM_LINUX
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <vector>
 #include "o2/Utils/Memory/MemoryManager.h"
@@ -87,7 +88,7 @@ namespace o2
 		}
 
 		// Returns cloned emplace copy of this in memory
-		IFunction* Clone(void* memory) const
+		IFunction<_res_type(_args ...)>* Clone(void* memory) const
 		{
 			return new (memory) FunctionPtr(*this);
 		}
@@ -464,7 +465,7 @@ namespace o2
 		}
 
 		// Constructor from static function pointer
-		template<typename _static_func_type, typename enable = std::enable_if<std::is_function<_static_func_type>::value>::type>
+		template<typename _static_func_type, typename enable = typename std::enable_if<std::is_function<_static_func_type>::value>::type>
 		Function(const _static_func_type* func):
 			Function()
 		{
@@ -472,7 +473,7 @@ namespace o2
 		}
 
 		// Constructor from lambda
-		template<typename _lambda_type, typename enable = std::enable_if<std::is_invocable_r<_res_type, _lambda_type, _args ...>::value && !std::is_base_of<IFunction<_res_type(_args ...)>, _lambda_type>::value>::type>
+		template<typename _lambda_type, typename enable = typename std::enable_if<std::is_invocable_r<_res_type, _lambda_type, _args ...>::value && !std::is_base_of<IFunction<_res_type(_args ...)>, _lambda_type>::value>::type>
 		Function(const _lambda_type& lambda):
 			Function()
 		{
@@ -480,9 +481,9 @@ namespace o2
 		}
 
 		// Move-constructor from lambda
-		template<typename _lambda_type, typename enable = std::enable_if<
+		template<typename _lambda_type, typename enable = typename std::enable_if<
 			std::is_invocable_r<_res_type, _lambda_type, _args ...>::value &&
-			!std::is_base_of<IFunction<_res_type(_args ...)>, std::remove_reference<_lambda_type>::type>::value &&
+			!std::is_base_of<IFunction<_res_type(_args ...)>, typename std::remove_reference<_lambda_type>::type>::value &&
 			std::is_rvalue_reference<_lambda_type&&>::value
 		>::type>
 		Function(_lambda_type&& lambda):
@@ -558,7 +559,7 @@ namespace o2
 		}
 
 		// Emplace function
-		template<typename _function_type, typename enabled = std::enable_if<std::is_base_of<IFunction<_res_type(_args ...)>, _function_type>::value>::type>
+		template<typename _function_type, typename enabled = typename std::enable_if<std::is_base_of<IFunction<_res_type(_args ...)>, _function_type>::value>::type>
 		void Emplace(_function_type&& func)
 		{
 			auto size = sizeof(_function_type);
@@ -1,6 +1,8 @@
 #include "o2/stdafx.h"
 #include "Curve.h"
 
+#include "o2/EngineSettings.h"
+#include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Math/Interpolation.h"
 #include "o2/Utils/Tools/KeySearch.h"
 
@@ -22,7 +24,7 @@ namespace o2
 	}
 
 	Curve::Curve(const Curve& other) :
-		mKeys(other.mKeys), keys(this), length(this)
+		mKeys(other.mKeys), mBakeSampleRate(other.mBakeSampleRate), mBakedValues(other.mBakedValues), keys(this), length(this)
 	{ }
 
 	bool Curve::operator!=(const Curve& other) const
@@ -47,6 +49,7 @@ namespace o2
 	Curve& Curve::operator=(const Curve& other)
 	{
 		mKeys = other.mKeys;
+		mBakeSampleRate = other.mBakeSampleRate;
 
 		UpdateApproximation();
 
@@ -68,6 +71,14 @@ namespace o2
 	}
 
 	float Curve::Evaluate(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
+	{
+		if (!mBakedValues.IsEmpty() && mBakedValues.IsInRange(position))
+			return mBakedValues.Evaluate(position);
+
+		return EvaluateApproximated(position, direction, cacheKey, cacheKeyApprox);
+	}
+
+	float Curve::EvaluateApproximated(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
 	{
 		int count = mKeys.Count();
 
@@ -103,6 +114,39 @@ namespace o2
 		return Math::Lerp(segLeft.value, segRight.value, coef);
 	}
 
+	void Curve::SetBakeSampleRate(float sampleRate)
+	{
+		mBakeSampleRate = Math::Max(sampleRate, 0.0f);
+		UpdateBakedValues();
+	}
+
+	float Curve::GetBakeSampleRate() const
+	{
+		return mBakeSampleRate;
+	}
+
+	bool Curve::IsBaked() const
+	{
+		return !mBakedValues.IsEmpty();
+	}
+
+	float Curve::GetBakedMaxError() const
+	{
+		int samplesCount = mBakedValues.GetSamplesCount();
+		float begin = mBakedValues.GetBegin(), step = mBakedValues.GetStep();
+
+		float maxError = 0.0f;
+		int cacheKey = 0, cacheKeyApprox = 0;
+		for (int i = 0; i < samplesCount - 1; i++)
+		{
+			float position = begin + step*((float)i + 0.5f);
+			float error = Math::Abs(mBakedValues.Evaluate(position) - EvaluateApproximated(position, true, cacheKey, cacheKeyApprox));
+			maxError = Math::Max(maxError, error);
+		}
+
+		return maxError;
+	}
+
 	void Curve::BeginKeysBatchChange()
 	{
 		mBatchChange = true;
@@ -545,6 +589,7 @@ namespace o2
 	void Curve::RemoveAllKeys()
 	{
 		mKeys.Clear();
+		mBakedValues.Clear();
 		onKeysChanged();
 	}
 
@@ -733,9 +778,39 @@ namespace o2
 			}
 		}
 
+		UpdateBakedValues();
+
 		onKeysChanged();
 	}
 
+	void Curve::UpdateBakedValues()
+	{
+		if (mBakeSampleRate <= 0.0f || mKeys.Count() < 2)
+		{
+			mBakedValues.Clear();
+			return;
+		}
+
+		int cacheKey = 0, cacheKeyApprox = 0;
+		mBakedValues.Bake(mKeys[0].position, mKeys.Last().position, mBakeSampleRate, [&](float position)
+		{
+			return EvaluateApproximated(position, true, cacheKey, cacheKeyApprox);
+		});
+
+#if BAKED_VALUES_CHECK
+		float minValue = mKeys[0].value, maxValue = mKeys[0].value;
+		for (auto& key : mKeys)
+		{
+			minValue = Math::Min(minValue, key.value);
+			maxValue = Math::Max(maxValue, key.value);
+		}
+
+		float maxError = GetBakedMaxError();
+		if (maxError > GetBakedValuesMaxRelativeError()*Math::Max(maxValue - minValue, 1.0f))
+			o2Debug.LogWarning("Baked curve error %f is too large for sample rate %f", maxError, mBakeSampleRate);
+#endif
+	}
+
 	Vector<Curve::Key> Curve::GetKeysNonContant()
 	{
 		return mKeys;
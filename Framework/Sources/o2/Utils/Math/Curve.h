@@ -2,6 +2,7 @@
 
 #include "o2/Utils/Math/ApproximationValue.h"
 #include "o2/Utils/Math/Math.h"
+#include "o2/Utils/Math/UniformSamples.h"
 #include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
@@ -56,6 +57,25 @@ namespace o2
 		// Returns value by position
 		float Evaluate(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+		// Returns value by position from keys approximation, even when curve is baked
+		float EvaluateApproximated(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
+
+		// Sets baked samples count per position unit. Baked curve is sampled uniformly on each keys change and
+		// evaluated inside keys range by direct index lookup and lerp. 0 disables baking.
+		// Baking smooths discontinuities: a value jump between keys becomes a ramp one sample step long, and
+		// peaks narrower than sample step are cut
+		void SetBakeSampleRate(float sampleRate);
+
+		// Returns baked samples count per position unit, 0 when baking is disabled
+		float GetBakeSampleRate() const;
+
+		// Returns true when curve has baked samples
+		bool IsBaked() const;
+
+		// Returns max difference between baked and approximated values. It is measured in the middles between samples,
+		// where lerp error is largest. Returns 0 when curve isn't baked
+		float GetBakedMaxError() const;
+
 		// It is called when beginning keys batch change. After this call all keys modifications will not be update approximation
 		// Used for optimizing many keys change
 		void BeginKeysBatchChange();
@@ -267,6 +287,9 @@ namespace o2
 
 		Vector<Key> mKeys; // Curve keys @SERIALIZABLE
 
+		float                 mBakeSampleRate = 0.0f; // Baked samples count per position unit, 0 when baking is disabled @SERIALIZABLE
+		UniformSamples<float> mBakedValues;           // Baked uniform samples, updated with approximation
+
 	protected:
 		// Checks all smooth keys and updates supports points
 		void CheckSmoothKeys();
@@ -274,6 +297,9 @@ namespace o2
 	    // Updates approximation
 		void UpdateApproximation();
 
+		// Samples curve uniformly when baking is enabled, otherwise clears baked samples
+		void UpdateBakedValues();
+
 		// Returns keys (for property)
 		Vector<Key> GetKeysNonContant();
 
@@ -303,6 +329,8 @@ CLASS_FIELDS_META(o2::Curve)
 	PROTECTED_FIELD(mBatchChange).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mChangedKeys).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mKeys).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakeSampleRate).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedValues);
 }
 END_META;
 CLASS_METHODS_META(o2::Curve)
@@ -310,6 +338,11 @@ CLASS_METHODS_META(o2::Curve)
 
 	PUBLIC_FUNCTION(float, Evaluate, float);
 	PUBLIC_FUNCTION(float, Evaluate, float, bool, int&, int&);
+	PUBLIC_FUNCTION(float, EvaluateApproximated, float, bool, int&, int&);
+	PUBLIC_FUNCTION(void, SetBakeSampleRate, float);
+	PUBLIC_FUNCTION(float, GetBakeSampleRate);
+	PUBLIC_FUNCTION(bool, IsBaked);
+	PUBLIC_FUNCTION(float, GetBakedMaxError);
 	PUBLIC_FUNCTION(void, BeginKeysBatchChange);
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(void, MoveKeys, float);
@@ -355,6 +388,7 @@ CLASS_METHODS_META(o2::Curve)
 	PUBLIC_STATIC_FUNCTION(Curve, Linear);
 	PROTECTED_FUNCTION(void, CheckSmoothKeys);
 	PROTECTED_FUNCTION(void, UpdateApproximation);
+	PROTECTED_FUNCTION(void, UpdateBakedValues);
 	PROTECTED_FUNCTION(Vector<Key>, GetKeysNonContant);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, InternalSmoothKeyAt, int, float);
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include <utility>
+
+namespace o2
+{
+	// ------------------------------------------------------------------------------------------------------
+	// Small pseudo random numbers generator with own state (xorshift64*). Same seed gives same sequence on
+	// any thread, so owners of generators can be updated in parallel and stay deterministic. Not thread safe
+	// itself, each thread or object must use own generator
+	// ------------------------------------------------------------------------------------------------------
+	class RandomGenerator
+	{
+	public:
+		// Default constructor, seeds by zero
+		inline RandomGenerator();
+
+		// Constructor with seed
+		inline explicit RandomGenerator(UInt64 seed);
+
+		// Restarts sequence from seed
+		inline void SetSeed(UInt64 seed);
+
+		// Returns next random 64 bit value
+		inline UInt64 Next();
+
+		// Returns random value in range [0, 1)
+		inline float Random();
+
+		// Returns random value in range [minValue, maxValue)
+		inline float Random(float minValue, float maxValue);
+
+		// Returns random value in range [minValue, maxValue], bounds can be in any order
+		inline int Random(int minValue, int maxValue);
+
+	protected:
+		UInt64 mState; // Current generator state, never zero
+	};
+
+	RandomGenerator::RandomGenerator()
+	{
+		SetSeed(0);
+	}
+
+	RandomGenerator::RandomGenerator(UInt64 seed)
+	{
+		SetSeed(seed);
+	}
+
+	void RandomGenerator::SetSeed(UInt64 seed)
+	{
+		// Seed is mixed by splitmix64, so close seeds give unrelated sequences and state is never zero
+		UInt64 z = seed + 0x9E3779B97F4A7C15ull;
+		z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27))*0x94D049BB133111EBull;
+		z = z ^ (z >> 31);
+
+		mState = z != 0 ? z : 0x9E3779B97F4A7C15ull;
+	}
+
+	UInt64 RandomGenerator::Next()
+	{
+		mState ^= mState >> 12;
+		mState ^= mState << 25;
+		mState ^= mState >> 27;
+		return mState*0x2545F4914F6CDD1Dull;
+	}
+
+	float RandomGenerator::Random()
+	{
+		// Upper 24 bits fit float mantissa exactly
+		return (float)(Next() >> 40)*(1.0f/16777216.0f);
+	}
+
+	float RandomGenerator::Random(float minValue, float maxValue)
+	{
+		return minValue + (maxValue - minValue)*Random();
+	}
+
+	int RandomGenerator::Random(int minValue, int maxValue)
+	{
+		if (minValue > maxValue)
+			std::swap(minValue, maxValue);
+
+		UInt64 range = (UInt64)((Int64)maxValue - (Int64)minValue) + 1;
+		return (int)((Int64)minValue + (Int64)(Next()%range));
+	}
+}
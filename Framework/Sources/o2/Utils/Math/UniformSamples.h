@@ -0,0 +1,127 @@
+#pragma once
+
+#include "o2/Utils/Math/Math.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// --------------------------------------------------------------------------------------------------------
+	// Values of function uniformly sampled in positions range. Value at position is got by direct index lookup
+	// and lerp between two nearest samples, without keys search. Used for baking curves and animation tracks
+	// --------------------------------------------------------------------------------------------------------
+	template<typename _type>
+	class UniformSamples
+	{
+	public:
+		static constexpr int mMaxSamplesCount = 16384; // Max samples count, limits memory for long ranges
+
+	public:
+		// Samples function in range [begin, end] with sampleRate samples per position unit. Function is
+		// called with increasing positions as _type(float position)
+		template<typename _func>
+		void Bake(float begin, float end, float sampleRate, const _func& func);
+
+		// Removes all samples
+		void Clear();
+
+		// Returns true when there is no samples
+		bool IsEmpty() const;
+
+		// Returns true when position is inside sampled range
+		bool IsInRange(float position) const;
+
+		// Returns lerped value between nearest samples. Position must be inside sampled range
+		_type Evaluate(float position) const;
+
+		// Returns samples count
+		int GetSamplesCount() const;
+
+		// Returns beginning of sampled range
+		float GetBegin() const;
+
+		// Returns end of sampled range
+		float GetEnd() const;
+
+		// Returns distance between samples
+		float GetStep() const;
+
+	protected:
+		Vector<_type> mValues;         // Sampled values
+		float         mBegin = 0.0f;   // Beginning of sampled range
+		float         mEnd = 0.0f;     // End of sampled range
+		float         mInvStep = 0.0f; // Inverted distance between samples
+	};
+
+	template<typename _type>
+	template<typename _func>
+	void UniformSamples<_type>::Bake(float begin, float end, float sampleRate, const _func& func)
+	{
+		mBegin = begin;
+		mEnd = Math::Max(begin, end);
+
+		int count = Math::Clamp((int)ceilf((mEnd - mBegin)*sampleRate) + 1, 2, mMaxSamplesCount);
+		float step = (mEnd - mBegin)/(float)(count - 1);
+		mInvStep = step > 0.0f ? 1.0f/step : 0.0f;
+
+		mValues.Resize(count);
+		for (int i = 0; i < count - 1; i++)
+			mValues[i] = func(mBegin + step*(float)i);
+
+		mValues[count - 1] = func(mEnd);
+	}
+
+	template<typename _type>
+	void UniformSamples<_type>::Clear()
+	{
+		mValues.Clear();
+		mBegin = mEnd = mInvStep = 0.0f;
+	}
+
+	template<typename _type>
+	bool UniformSamples<_type>::IsEmpty() const
+	{
+		return mValues.IsEmpty();
+	}
+
+	template<typename _type>
+	bool UniformSamples<_type>::IsInRange(float position) const
+	{
+		return position >= mBegin && position <= mEnd;
+	}
+
+	template<typename _type>
+	_type UniformSamples<_type>::Evaluate(float position) const
+	{
+		float index = (position - mBegin)*mInvStep;
+		int left = (int)index;
+
+		if (left >= mValues.Count() - 1)
+			return mValues[mValues.Count() - 1];
+
+		return Math::Lerp(mValues[left], mValues[left + 1], index - (float)left);
+	}
+
+	template<typename _type>
+	int UniformSamples<_type>::GetSamplesCount() const
+	{
+		return mValues.Count();
+	}
+
+	template<typename _type>
+	float UniformSamples<_type>::GetBegin() const
+	{
+		return mBegin;
+	}
+
+	template<typename _type>
+	float UniformSamples<_type>::GetEnd() const
+	{
+		return mEnd;
+	}
+
+	template<typename _type>
+	float UniformSamples<_type>::GetStep() const
+	{
+		return mInvStep > 0.0f ? 1.0f/mInvStep : 0.0f;
+	}
+}
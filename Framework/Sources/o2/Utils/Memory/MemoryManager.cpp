@@ -104,17 +104,27 @@ namespace o2
 		info.size = size;
 		info.sourceLine = line;
 		info.source = source;
+
+		std::lock_guard<std::mutex> lock(mAllocsMutex);
 		mAllocs[memory] = info;
 		mTotalBytes += size;
 	}
 
 	void MemoryManager::OnMemoryRelease(void* memory)
 	{
-		std::map<void*, AllocInfo>::iterator fnd = mAllocs.find(memory);
-		if (fnd != mAllocs.end())
+		// Map node is only unlinked under lock and released after it. Releasing node calls global operator delete,
+		// which comes back here and would lock mutex again
+		std::map<void*, AllocInfo>::node_type node;
+
 		{
-			mTotalBytes -= (*fnd).second.size;
-			mAllocs.erase(fnd);
+			std::lock_guard<std::mutex> lock(mAllocsMutex);
+
+			std::map<void*, AllocInfo>::iterator fnd = mAllocs.find(memory);
+			if (fnd != mAllocs.end())
+			{
+				mTotalBytes -= (*fnd).second.size;
+				node = mAllocs.extract(fnd);
+			}
 		}
 	}
 
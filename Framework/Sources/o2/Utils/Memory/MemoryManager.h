@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <map>
+#include <mutex>
 
 #include "o2/EngineSettings.h"
 #include "o2/Utils/Types/CommonTypes.h"
@@ -81,8 +82,9 @@ namespace o2
 
 		static MemoryManager* mInstance; // Instance pointer
 
-		std::map<void*, AllocInfo> mAllocs;     // Allocations info
-		size_t                     mTotalBytes; // Total managed allocated bytes
+		std::map<void*, AllocInfo> mAllocs;      // Allocations info
+		size_t                     mTotalBytes;  // Total managed allocated bytes
+		std::mutex                 mAllocsMutex; // Allocations info mutex, memory can be allocated and released from any thread
 
 	protected:
 		// It is called when memory was allocated and registers allocation
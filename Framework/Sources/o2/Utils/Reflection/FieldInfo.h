@@ -2,9 +2,7 @@
 
 #include "o2/Utils/Reflection/Attributes.h"
 #include "o2/Utils/Reflection/TypeSerializer.h"
-#include "o2/Utils/Reflection/TypeSerializer.h"
 #include "o2/Utils/Reflection/TypeTraits.h"
-#include "o2/Utils/Serialization/DataValue.h"
 #include "o2/Utils/Types/CommonTypes.h"
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
@@ -80,6 +80,12 @@ namespace o2
 			func(0, processor);
 
 		mInstance->mInitializingFunctions.Clear();
+
+		BuildTypesAncestry();
+
+		for (auto& kv : mInstance->mTypes)
+			kv.second->BuildMembersLookup();
+
 		mInstance->mTypesInitialized = true;
 	}
 
@@ -125,4 +131,37 @@ namespace o2
 		mInstance->mTypes[FundamentalTypeContainer<void>::type->GetName()] = FundamentalTypeContainer<void>::type;
 		mInstance->mTypes[Type::Dummy::type->GetName()] = Type::Dummy::type;
 	}
+
+	void Reflection::BuildTypesAncestry()
+	{
+		int ancestryBitsCount = 0;
+		for (auto& kv : mInstance->mTypes)
+		{
+			for (auto& baseType : kv.second->mBaseTypes)
+			{
+				Type* type = const_cast<Type*>(baseType.type);
+				if (type->mAncestryIndex < 0)
+					type->mAncestryIndex = ancestryBitsCount++;
+			}
+		}
+
+		int wordsCount = (ancestryBitsCount + 63)/64;
+		for (auto& kv : mInstance->mTypes)
+		{
+			kv.second->mAncestry.Clear();
+			kv.second->mAncestry.Resize(wordsCount);
+			CollectAncestry(kv.second, kv.second);
+		}
+	}
+
+	void Reflection::CollectAncestry(Type* type, const Type* ancestor)
+	{
+		for (auto& baseType : ancestor->mBaseTypes)
+		{
+			int index = baseType.type->mAncestryIndex;
+			type->mAncestry[index/64] |= (UInt64)1 << (index%64);
+
+			CollectAncestry(type, baseType.type);
+		}
+	}
 }
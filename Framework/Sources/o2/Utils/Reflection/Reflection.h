@@ -24,6 +24,7 @@ namespace o2
 	class ReflectionInitializationTypeProcessor;
 	class FieldInfo;
 	class FunctionInfo;
+	class StaticFunctionInfo;
 
 	class IObject;
 
@@ -61,6 +62,11 @@ namespace o2
 		// Returns is types was initialized
 		static bool IsTypesInitialized();
 
+		// Casts object to target type. Checks type by precomputed ancestry, uses static_cast when target type isn't
+		// derived virtually from source type, otherwise dynamic_cast. Returns nullptr when object isn't based on target type
+		template<typename _target_type, typename _source_type>
+		static _target_type* Cast(_source_type* object);
+
 	public:
 		template<typename _type>
 		static Type* InitializeType(const char* name);
@@ -96,6 +102,10 @@ namespace o2
 		template<typename _source_type, typename _target_type>
 		static void* CastFunc(void* obj) { return dynamic_cast<_target_type*>((_source_type*)obj); }
 
+		// Type casting function template, uses static cast when possible
+		template<typename _source_type, typename _target_type>
+		static void* StaticCastFunc(void* obj);
+
 		// Fake type casting function
 		static void* NoCastFunc(void* obj) { return obj; }
 
@@ -122,6 +132,12 @@ namespace o2
 		// Initializes fundamental types
 		static void InitializeFundamentalTypes();
 
+		// Builds ancestry bits for all types: each type used as base gets bit index, and each type gets bits of all its base types
+		static void BuildTypesAncestry();
+
+		// Sets bits of all base types of ancestor into type's ancestry
+		static void CollectAncestry(Type* type, const Type* ancestor);
+
 		friend class Type;
 	};
 
@@ -143,6 +159,9 @@ namespace o2
 		template<typename _object_type, typename _base_type>
 		void BaseType(_object_type* object, Type* type, const char* name);
 
+		template<typename _object_type, typename _attribute_type>
+		void ClassAttribute(_object_type* object, Type* type);
+
 		template<typename _object_type, typename _field_type>
 		FieldInfo& Field(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*), _field_type& field, ProtectSection protection);
 
@@ -178,6 +197,24 @@ namespace o2
 		return (_type)0;
 	}
 
+	template<typename _target_type, typename _source_type>
+	_target_type* Reflection::Cast(_source_type* object)
+	{
+		if (!object || !object->GetType().IsBasedOn(TypeOf(_target_type)))
+			return nullptr;
+
+		return (_target_type*)StaticCastFunc<_source_type, _target_type>(object);
+	}
+
+	template<typename _source_type, typename _target_type>
+	void* Reflection::StaticCastFunc(void* obj)
+	{
+		if constexpr (IsStaticCastable<_source_type, _target_type>::value)
+			return static_cast<_target_type*>((_source_type*)obj);
+		else
+			return dynamic_cast<_target_type*>((_source_type*)obj);
+	}
+
 	template<typename _type>
 	String Reflection::GetEnumName(_type value)
 	{
@@ -338,6 +375,12 @@ namespace o2
 		TypeInitializer::AddBaseType<_object_type, _base_type>(type);
 	}
 
+	template<typename _object_type, typename _attribute_type>
+	void ReflectionInitializationTypeProcessor::ClassAttribute(_object_type* object, Type* type)
+	{
+		TypeInitializer::AddAttribute<_attribute_type>(type);
+	}
+
 	template<typename _object_type, typename _field_type>
 	FieldInfo& ReflectionInitializationTypeProcessor::Field(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*), _field_type& field, ProtectSection protection)
 	{
@@ -6,6 +6,7 @@
 #include "o2/Utils/Reflection/Reflection.h"
 #include "o2/Utils/Serialization/DataValue.h"
 #include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Tools/Hash.h"
 
 namespace o2
 {
@@ -17,6 +18,9 @@ namespace o2
 	{
 		for (auto func : mFunctions)
 			delete func;
+
+		for (auto attr : mAttributes)
+			delete attr;
 	}
 
 	bool Type::operator!=(const Type& other) const
@@ -49,6 +53,15 @@ namespace o2
 		if (mId == other.mId)
 			return true;
 
+		if (!mAncestry.IsEmpty())
+		{
+			if (other.mAncestryIndex < 0)
+				return false;
+
+			return (mAncestry[other.mAncestryIndex/64] >> (other.mAncestryIndex%64)) & 1;
+		}
+
+		// Ancestry isn't built yet or type was created after it
 		for (auto typeInfo : mBaseTypes)
 		{
 			if (typeInfo.type->mId == mId)
@@ -124,6 +137,12 @@ namespace o2
 
 	const FieldInfo* Type::GetField(const String& name) const
 	{
+		if (mMembersLookupBuilt)
+		{
+			auto fnd = mFieldsLookup.find(name);
+			return fnd != mFieldsLookup.end() ? fnd->second.field : nullptr;
+		}
+
 		for (auto& field : mFields)
 		{
 			if (field.GetName() == name)
@@ -141,6 +160,12 @@ namespace o2
 
 	const FunctionInfo* Type::GetFunction(const String& name) const
 	{
+		if (mMembersLookupBuilt)
+		{
+			auto fnd = mFunctionsLookup.find(name);
+			return fnd != mFunctionsLookup.end() ? fnd->second : nullptr;
+		}
+
 		for (auto func : mFunctions)
 		{
 			if (func->mName == name)
@@ -158,6 +183,12 @@ namespace o2
 
 	const StaticFunctionInfo* Type::GetStaticFunction(const String& name) const
 	{
+		if (mMembersLookupBuilt)
+		{
+			auto fnd = mStaticFunctionsLookup.find(name);
+			return fnd != mStaticFunctionsLookup.end() ? fnd->second : nullptr;
+		}
+
 		for (auto func : mStaticFunctions)
 		{
 			if (func->mName == name)
@@ -199,6 +230,34 @@ namespace o2
 	void* Type::GetFieldPtr(void* object, const String& path, const FieldInfo*& fieldInfo) const
 	{
 		int delPos = path.Find("/");
+
+		if (mMembersLookupBuilt)
+		{
+			auto fnd = mFieldsLookup.find(path.SubStr(0, delPos));
+			if (fnd == mFieldsLookup.end())
+				return nullptr;
+
+			const FieldInfo* field = fnd->second.field;
+
+			if (fnd->second.ownerCasts >= 0)
+			{
+				for (auto cast : mOwnerCastsChains[fnd->second.ownerCasts])
+					object = (*cast)(object);
+			}
+
+			if (delPos == -1)
+			{
+				fieldInfo = field;
+				return field->GetValuePtrStrong(object);
+			}
+
+			void* val = field->GetValuePtr(object);
+			if (!val)
+				return nullptr;
+
+			return field->SearchFieldPtr(val, path.SubStr(delPos + 1), fieldInfo);
+		}
+
 		WString pathPart = path.SubStr(0, delPos);
 
 		for (auto& field : mFields)
@@ -256,6 +315,62 @@ namespace o2
 		return mSerializer;
 	}
 
+	const Vector<IAttribute*>& Type::GetAttributes() const
+	{
+		return mAttributes;
+	}
+
+	void Type::BuildMembersLookup()
+	{
+		mFieldsLookup.clear();
+		mFunctionsLookup.clear();
+		mStaticFunctionsLookup.clear();
+		mOwnerCastsChains.Clear();
+
+		Vector<CastFunc> casts;
+		CollectMembersLookup(*this, casts);
+
+		mMembersLookupBuilt = true;
+	}
+
+	void Type::CollectMembersLookup(const Type& type, Vector<CastFunc>& casts)
+	{
+		int ownerCasts = -1;
+		if (!casts.IsEmpty())
+		{
+			ownerCasts = mOwnerCastsChains.Count();
+			mOwnerCastsChains.Add(casts);
+		}
+
+		// Members are emplaced in same order as linear search goes: own members first, then bases depth first.
+		// Emplace doesn't replace existing entries, so derived members hide base members with same names
+		for (auto& field : type.mFields)
+		{
+			FieldLookupEntry entry;
+			entry.field = &field;
+			entry.ownerCasts = ownerCasts;
+			mFieldsLookup.emplace(field.mName, entry);
+		}
+
+		for (auto func : type.mFunctions)
+			mFunctionsLookup.emplace(func->mName, func);
+
+		for (auto func : type.mStaticFunctions)
+			mStaticFunctionsLookup.emplace(func->mName, func);
+
+		for (auto& baseType : type.mBaseTypes)
+		{
+			casts.Add(baseType.dynamicCastUpFunc);
+			CollectMembersLookup(*baseType.type, casts);
+			casts.PopBack();
+		}
+	}
+
+	size_t Type::NameHash::operator()(const String& name) const
+	{
+		return (size_t)GetFNV1aHash(name.Data(), name.Length());
+	}
+
 	VectorType::VectorType(const String& name, int size, ITypeSerializer* serializer) :
 		Type(name, size, serializer)
 	{}
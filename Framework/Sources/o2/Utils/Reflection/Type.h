@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <unordered_map>
 #include "o2/Utils/Function.h"
 #include "o2/Utils/Reflection/Attributes.h"
 #include "o2/Utils/Reflection/TypeSerializer.h"
@@ -79,7 +80,7 @@ namespace o2
 		// Returns size of type in bytes
 		int GetSize() const;
 
-		// Is this type based on other
+		// Is this type based on other. Uses ancestry bits built after types initialization, it's constant time
 		bool IsBasedOn(const Type& other) const;
 
 		// Returns pointer of type (type -> type*)
@@ -109,13 +110,13 @@ namespace o2
 		// Returns functions informations array with all base types
 		Vector<StaticFunctionInfo*> GetStaticFunctionsWithBaseClasses() const;
 
-		// Returns field information by name
+		// Returns field information by name, including base types fields
 		const FieldInfo* GetField(const String& name) const;
 
-		// Returns function info by name
+		// Returns function info by name, including base types functions
 		const FunctionInfo* GetFunction(const String& name) const;
 
-		// Returns static function info by name
+		// Returns static function info by name, including base types functions
 		const StaticFunctionInfo* GetStaticFunction(const String& name) const;
 
 		// Invokes function with name
@@ -153,6 +154,17 @@ namespace o2
 		// Returns type serializer
 		ITypeSerializer* GetSerializer() const;
 
+		// Returns class attribute, if it is not exist - returns nullptr. Attributes of base types are not checked
+		template<typename _attr_type>
+		_attr_type* GetAttribute() const;
+
+		// Returns true if exist class attribute with specified type. Attributes of base types are not checked
+		template<typename _attr_type>
+		bool HasAttribute() const;
+
+		// Returns class attributes array
+		const Vector<IAttribute*>& GetAttributes() const;
+
 	public:
 		// --------------------
 		// Dummy type container
@@ -165,6 +177,30 @@ namespace o2
 		template<class T>
 		struct IsConstructible<T, void_t<decltype(std::declval<T()>())>>: std::true_type {};
 
+	protected:
+		typedef void*(*CastFunc)(void*);
+
+		// ----------------------------------------------------------------------------------------------
+		// Members names hash function. Names hashes are calculated once when lookup tables are being built
+		// ----------------------------------------------------------------------------------------------
+		struct NameHash
+		{
+			size_t operator()(const String& name) const;
+		};
+
+		// ---------------------------------------------------------------------------------------
+		// Field lookup entry. Field is owned by this or base type, object must be casted to owner
+		// ---------------------------------------------------------------------------------------
+		struct FieldLookupEntry
+		{
+			const FieldInfo* field = nullptr; // Field information
+			int              ownerCasts = -1; // Index of casts chain to field's owner type. -1 for own fields
+		};
+
+		typedef std::unordered_map<String, FieldLookupEntry, NameHash> FieldsLookupMap;
+		typedef std::unordered_map<String, const FunctionInfo*, NameHash> FunctionsLookupMap;
+		typedef std::unordered_map<String, const StaticFunctionInfo*, NameHash> StaticFunctionsLookupMap;
+
 	protected:
 		TypeId mId;   // Id of type
 		String mName; // Name of object type
@@ -172,14 +208,32 @@ namespace o2
 
 		Vector<BaseType> mBaseTypes; // Base types ids with offset 
 
+		int            mAncestryIndex = -1; // Index of bit in ancestry bits of derived types. -1 when type isn't base for any type
+		Vector<UInt64> mAncestry;           // Bits of all base types by their ancestry indexes. Built by reflection after types initialization
+
 		Vector<FieldInfo>           mFields;          // Fields information
 		Vector<FunctionInfo*>       mFunctions;       // Functions informations
 		Vector<StaticFunctionInfo*> mStaticFunctions; // Functions informations
 
+		Vector<IAttribute*> mAttributes; // Class attributes
+
+		FieldsLookupMap          mFieldsLookup;               // Fields by names, including base types fields
+		FunctionsLookupMap       mFunctionsLookup;            // Functions by names, including base types functions
+		StaticFunctionsLookupMap mStaticFunctionsLookup;      // Static functions by names, including base types functions
+		Vector<Vector<CastFunc>> mOwnerCastsChains;           // Casts chains from this type to base types, owning fields
+		bool                     mMembersLookupBuilt = false; // Are lookup tables built. Until that members are searched linearly
+
 		mutable Type* mPtrType = nullptr; // Pointer type from this
 
 		ITypeSerializer* mSerializer = nullptr; // Value serializer
 
+	protected:
+		// Builds members lookup tables including base types members. Called by reflection after types initialization
+		void BuildMembersLookup();
+
+		// Adds type's and its base types members into lookup tables. Casts is chain from this type to type
+		void CollectMembersLookup(const Type& type, Vector<CastFunc>& casts);
+
 		friend class FieldInfo;
 		friend class FunctionInfo;
 		friend class PointerType;
@@ -661,6 +715,10 @@ namespace o2
 		template<typename _this_type, typename _base_type, typename X = typename std::conditional<std::is_base_of<IObject, _base_type>::value, _base_type, Type::Dummy>::type>
 		static void AddBaseType(Type*& type);
 
+		// Adds class attribute
+		template<typename _attribute_type>
+		static void AddAttribute(Type* type);
+
 		// Registers field in type
 		template<typename _type>
 		static FieldInfo& RegField(Type* type, const String& name, void*(*pointerGetter)(void*), _type& value, ProtectSection section);
@@ -700,6 +758,9 @@ namespace o2
 		template<typename _object_type, typename _base_type>
 		void BaseType(_object_type* object, Type* type, const char* name) {}
 
+		template<typename _object_type, typename _attribute_type>
+		void ClassAttribute(_object_type* object, Type* type) {}
+
 		template<typename _object_type, typename _field_type>
 		FieldInfo& Field(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*), _field_type& field, ProtectSection protection) {}
 
@@ -765,6 +826,9 @@ typedef void*(*GetValuePointerFuncPtr)(void*);
 #define BASE_CLASS(CLASS) \
     processor.template BaseType<thisclass, CLASS>(object, type, #CLASS)
 
+#define CLASS_ATTRIBUTE(NAME) \
+    processor.template ClassAttribute<thisclass, NAME>(object, type)
+
 #define FIELD(NAME, PROTECT_SECTION) \
     processor.template Field<thisclass, decltype(object->NAME)>(object, type, #NAME, (GetValuePointerFuncPtr)([](void* obj) { return (void*)&((thisclass*)obj)->NAME; }), object->NAME, ProtectSection::PROTECT_SECTION)
 
@@ -814,13 +878,57 @@ typedef void*(*GetValuePointerFuncPtr)(void*);
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Reflection/FieldInfo.h"
 #include "o2/Utils/Reflection/FunctionInfo.h"
+#include "o2/Utils/Reflection/Reflection.h"
 #include "o2/Utils/Reflection/TypeTraits.h"
+#include "o2/Utils/Serialization/DataValue.h"
 #include "o2/Utils/Types/StringImpl.h"
 #include "o2/Utils/Types/UID.h"
 #include "o2/Utils/ValueProxy.h"
 
 namespace o2
 {
+	// Returns type of template parameter
+	template<typename _type>
+	const Type& GetTypeOf()
+	{
+		if constexpr (std::is_pointer<_type>::value)
+		{
+			return *GetTypeOf<typename std::remove_pointer<_type>::type>().GetPointerType();
+		}
+		else if constexpr (IsVector<_type>::value)
+		{
+			return *Reflection::InitializeVectorType<typename ExtractVectorElementType<_type>::type>();
+		}
+		else if constexpr (IsStringAccessor<_type>::value)
+		{
+			return *Reflection::InitializeAccessorType<typename _type::valueType, _type>();
+		}
+		else if constexpr (IsMap<_type>::value)
+		{
+			return *Reflection::InitializeMapType<typename ExtractMapKeyType<_type>::type, typename ExtractMapValueType<_type>::type>();
+		}
+		else if constexpr (IsProperty<_type>::value)
+		{
+			return *Reflection::InitializePropertyType<typename _type::valueType, _type>();
+		}
+		else if constexpr (std::is_base_of<IObject, _type>::value)
+		{
+			return *_type::type;
+		}
+		else if constexpr (IsFundamental<_type>::value && !std::is_const<_type>::value)
+		{
+			return *FundamentalTypeContainer<_type>::type;
+		}
+		else if constexpr (std::is_enum<_type>::value && IsEnumReflectable<_type>::value)
+		{
+			return *EnumTypeContainer<_type>::type;
+		}
+		else
+		{
+			return *Type::Dummy::type;
+		}
+	}
+
 	// -------------------
 	// Type implementation
 	// -------------------
@@ -843,6 +951,31 @@ namespace o2
 		return _res_type();
 	}
 
+	template<typename _attr_type>
+	bool Type::HasAttribute() const
+	{
+		for (auto attr : mAttributes)
+		{
+			if (dynamic_cast<_attr_type*>(attr))
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename _attr_type>
+	_attr_type* Type::GetAttribute() const
+	{
+		for (auto attr : mAttributes)
+		{
+			_attr_type* res = dynamic_cast<_attr_type*>(attr);
+			if (res)
+				return res;
+		}
+
+		return nullptr;
+	}
+
 	// --------------------
 	// TType implementation
 	// --------------------
@@ -884,7 +1017,7 @@ namespace o2
 	template<typename _type>
 	void* TObjectType<_type>::CreateSample() const
 	{
-		if constexpr (IsConstructible<_type>::value || std::is_constructible<_type>::value)
+		if constexpr (!std::is_abstract<_type>::value && (IsConstructible<_type>::value || std::is_constructible<_type>::value))
 			return mnew _type();
 		else
 		{
@@ -1114,11 +1247,11 @@ namespace o2
 		data["Size"].Get(newSize);
 		type.SetObjectVectorSize(object, newSize);
 
-		if (auto elementsData = data.GetMember("Elements"))
+		if (auto elementsData = data.FindMember("Elements"))
 		{
 			for (int i = size; i < newSize; i++)
 			{
-				if (auto elementData = elementsData->GetMember("Element" + (WString)i))
+				if (auto elementData = elementsData->FindMember("Element" + (String)i))
 				{
 					void* elementPtr = type.GetObjectVectorElementPtr(object, i);
 					type.mElementFieldInfo->Deserialize(elementPtr, *elementData);
@@ -1306,12 +1439,19 @@ namespace o2
 
 		Type::BaseType baseTypeInfo;
 		baseTypeInfo.type = X::type;
-		baseTypeInfo.dynamicCastUpFunc = &Reflection::CastFunc<_this_type, _base_type>;
+		baseTypeInfo.dynamicCastUpFunc = &Reflection::StaticCastFunc<_this_type, _base_type>;
 		baseTypeInfo.dynamicCastDownFunc = &Reflection::CastFunc<_base_type, _this_type>;
 
 		type->mBaseTypes.Add(baseTypeInfo);
 	}
 
+	template<typename _attribute_type>
+	void TypeInitializer::AddAttribute(Type* type)
+	{
+		if (!type->HasAttribute<_attribute_type>())
+			type->mAttributes.Add(mnew _attribute_type());
+	}
+
 	template<typename _type>
 	FieldInfo& TypeInitializer::RegField(Type* type, const String& name, void*(*pointerGetter)(void*), _type& value,
 										 ProtectSection section)
@@ -1,9 +1,16 @@
 #pragma once
 
+#include "o2/Utils/Math/Math.h"
+#include "o2/Utils/Reflection/TypeTraits.h"
+
 namespace o2
 {
 	class DataValue;
 
+	// Is DataValue supporting type trait. Defined after DataValue, it is incomplete here
+	template<typename _type>
+	struct IsDataValueSupports;
+
 	struct ITypeSerializer
 	{
 		virtual ~ITypeSerializer() { }
@@ -21,7 +28,7 @@ namespace o2
 	template<typename _type>
 	struct TypeSerializer : public ITypeSerializer
 	{
-		static constexpr bool isSerializable = DataValue::IsSupports<_type>::value;
+		static constexpr bool isSerializable = IsDataValueSupports<_type>::value;
 		static constexpr bool isEqualsSupport = SupportsEqualOperator<_type>::value;
 		static constexpr bool isCopyable = std::is_assignable<_type&, _type>::value;
 
@@ -77,6 +77,12 @@ namespace o2
 	template<class T>
 	struct SupportsMultiply<T, void_t<decltype(std::declval<T>() * std::declval<T>())>>: std::true_type {};
 
+	template<class From, class To, class = void_t<>>
+	struct IsStaticCastable: std::false_type {};
+
+	template<class From, class To>
+	struct IsStaticCastable<From, To, void_t<decltype(static_cast<To*>(std::declval<From*>()))>>: std::true_type {};
+
 	template<class T, class = void_t<>>
 	struct SupportsEqualOperator: std::false_type {};
 
@@ -112,51 +118,3 @@ namespace o2
 		std::is_same<T, UID>::value ||
 		std::is_same<T, DataValue>::value, std::true_type, std::false_type>::type {};
 }
-
-#include "o2/Utils/Reflection/Type.h"
-
-namespace o2
-{
-
-	// Returns type of template parameter
-	template<typename _type>
-	const Type& GetTypeOf()
-	{
-		if constexpr (std::is_pointer<_type>::value)
-		{
-			return *GetTypeOf<typename std::remove_pointer<_type>::type>().GetPointerType();
-		}
-		else if constexpr (IsVector<_type>::value)
-		{
-			return *Reflection::InitializeVectorType<typename ExtractVectorElementType<_type>::type>();
-		}
-		else if constexpr (IsStringAccessor<_type>::value)
-		{
-			return *Reflection::InitializeAccessorType<typename _type::valueType, _type>();
-		}
-		else if constexpr (IsMap<_type>::value)
-		{
-			return *Reflection::InitializeMapType<typename ExtractMapKeyType<_type>::type, typename ExtractMapValueType<_type>::type>();
-		}
-		else if constexpr (IsProperty<_type>::value)
-		{
-			return *Reflection::InitializePropertyType<typename _type::valueType, _type>();
-		}
-		else if constexpr (std::is_base_of<IObject, _type>::value)
-		{
-			return *_type::type;
-		}
-		else if constexpr (IsFundamental<_type>::value && !std::is_const<_type>::value)
-		{
-			return *FundamentalTypeContainer<_type>::type;
-		}
-		else if constexpr (std::is_enum<_type>::value && IsEnumReflectable<_type>::value)
-		{
-			return *EnumTypeContainer<_type>::type;
-		}
-		else
-		{
-			return *Type::Dummy::type;
-		}
-	}
-}
@@ -0,0 +1,364 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+namespace o2
+{
+	bool ParseBinaryInplace(char* data, size_t size, DataDocument& document)
+	{
+		BinaryDataDocumentReader reader(data, size, true, document);
+		return reader.Read();
+	}
+
+	bool ParseBinary(const char* data, size_t size, DataDocument& document)
+	{
+		BinaryDataDocumentReader reader(data, size, false, document);
+		return reader.Read();
+	}
+
+	void WriteBinary(String& str, const DataDocument& document)
+	{
+		BinaryDataDocumentWriter writer(str);
+		writer.Write(document);
+	}
+
+	bool IsBinaryData(const char* data, size_t size)
+	{
+		return size >= sizeof(BinaryDataFormat::signature) + 1 &&
+			memcmp(data, BinaryDataFormat::signature, sizeof(BinaryDataFormat::signature)) == 0;
+	}
+
+	BinaryDataDocumentReader::BinaryDataDocumentReader(const char* data, size_t size, bool isInplace, DataDocument& document):
+		document(document), mData((const UInt8*)data), mDataEnd((const UInt8*)data + size), mIsInplace(isInplace)
+	{}
+
+	bool BinaryDataDocumentReader::Read()
+	{
+		if (!IsBinaryData((const char*)mData, mDataEnd - mData))
+			return false;
+
+		mData += sizeof(BinaryDataFormat::signature);
+
+		if (*mData++ != BinaryDataFormat::version)
+			return false;
+
+		UInt64 namesCount;
+		if (!ReadVarInt(namesCount) || namesCount > (UInt64)(mDataEnd - mData))
+			return false;
+
+		mNames.Reserve((int)namesCount);
+		for (UInt64 i = 0; i < namesCount; i++)
+		{
+			UInt64 length;
+			if (!ReadVarInt(length) || length >= (UInt64)(mDataEnd - mData) || mData[length] != '\0')
+				return false;
+
+			Name name;
+			name.length = (int)length;
+
+			// Names are copied once into document and referenced by all members
+			if (mIsInplace)
+				name.string = (const char*)mData;
+			else
+			{
+				char* copy = (char*)document.mAllocator.Allocate(length + 1);
+				memcpy(copy, mData, length + 1);
+				name.string = copy;
+			}
+
+			mNames.Add(name);
+			mData += length + 1;
+		}
+
+		DataValue root(document);
+		if (!ReadValue(root))
+			return false;
+
+		(DataValue&)document = std::move(root);
+		return true;
+	}
+
+	bool BinaryDataDocumentReader::ReadVarInt(UInt64& value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			if (mData == mDataEnd)
+				return false;
+
+			UInt8 byte = *mData++;
+			value |= (UInt64)(byte & 0x7f) << shift;
+
+			if ((byte & 0x80) == 0)
+				return true;
+		}
+
+		return false;
+	}
+
+	bool BinaryDataDocumentReader::ReadString(DataValue& value)
+	{
+		UInt64 length;
+		if (!ReadVarInt(length) || length >= (UInt64)(mDataEnd - mData) || mData[length] != '\0')
+			return false;
+
+		// Short strings are stored inside value anyway, long strings are referenced when parsing in place
+		bool isCopy = !mIsInplace || length <= DataValue::ShortStringData::maxLength;
+		value.SetString((const char*)mData, (int)length, isCopy);
+
+		mData += length + 1;
+		return true;
+	}
+
+	bool BinaryDataDocumentReader::ReadValue(DataValue& value)
+	{
+		if (mData == mDataEnd)
+			return false;
+
+		auto tag = (BinaryDataFormat::Tag)*mData++;
+		switch (tag)
+		{
+			case BinaryDataFormat::Tag::Null:
+			value.SetNull();
+			return true;
+
+			case BinaryDataFormat::Tag::False:
+			value.mData.flagsData.flags = DataValue::Flags::Bool | DataValue::Flags::BoolFalse;
+			return true;
+
+			case BinaryDataFormat::Tag::True:
+			value.mData.flagsData.flags = DataValue::Flags::Bool | DataValue::Flags::BoolTrue;
+			return true;
+
+			case BinaryDataFormat::Tag::Int:
+			case BinaryDataFormat::Tag::Int64:
+			{
+				UInt64 zigzag;
+				if (!ReadVarInt(zigzag))
+					return false;
+
+				Int64 number = (Int64)(zigzag >> 1) ^ -(Int64)(zigzag & 1);
+				if (tag == BinaryDataFormat::Tag::Int)
+					value = (int)number;
+				else
+					value = number;
+
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::UInt:
+			case BinaryDataFormat::Tag::UInt64:
+			{
+				UInt64 number;
+				if (!ReadVarInt(number))
+					return false;
+
+				if (tag == BinaryDataFormat::Tag::UInt)
+					value = (UInt)number;
+				else
+					value = number;
+
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::Double:
+			{
+				double number;
+				if (mDataEnd - mData < (int)sizeof(double))
+					return false;
+
+				memcpy(&number, mData, sizeof(double));
+				mData += sizeof(double);
+				value = number;
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::String:
+			return ReadString(value);
+
+			case BinaryDataFormat::Tag::Object:
+			{
+				UInt64 count;
+				if (!ReadVarInt(count) || count > (UInt64)(mDataEnd - mData))
+					return false;
+
+				value.mData.flagsData.flags = DataValue::Flags::Object;
+				value.mData.objectData.members = count > 0 ? (DataMember*)document.mAllocator.Allocate(sizeof(DataMember)*count) : nullptr;
+				value.mData.objectData.count = 0;
+				value.mData.objectData.capacity = (UInt)count;
+
+				for (UInt64 i = 0; i < count; i++)
+				{
+					UInt64 nameIdx;
+					if (!ReadVarInt(nameIdx) || nameIdx >= (UInt64)mNames.Count())
+						return false;
+
+					DataMember* member = value.mData.objectData.members + i;
+					new (&member->name) DataValue(document);
+					new (&member->value) DataValue(document);
+
+					const Name& name = mNames[(int)nameIdx];
+					member->name.SetString(name.string, name.length, false);
+
+					value.mData.objectData.count++;
+
+					if (!ReadValue(member->value))
+						return false;
+				}
+
+				value.UpdateMembersIndex();
+				return true;
+			}
+
+			case BinaryDataFormat::Tag::Array:
+			{
+				UInt64 count;
+				if (!ReadVarInt(count) || count > (UInt64)(mDataEnd - mData))
+					return false;
+
+				value.mData.flagsData.flags = DataValue::Flags::Array;
+				value.mData.arrayData.elements = count > 0 ? (DataValue*)document.mAllocator.Allocate(sizeof(DataValue)*count) : nullptr;
+				value.mData.arrayData.count = 0;
+				value.mData.arrayData.capacity = (UInt)count;
+
+				for (UInt64 i = 0; i < count; i++)
+				{
+					DataValue* element = new (value.mData.arrayData.elements + i) DataValue(document);
+					value.mData.arrayData.count++;
+
+					if (!ReadValue(*element))
+						return false;
+				}
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	BinaryDataDocumentWriter::BinaryDataDocumentWriter(String& buffer):
+		buffer(buffer)
+	{}
+
+	void BinaryDataDocumentWriter::Write(const DataDocument& document)
+	{
+		CollectNames(document);
+
+		buffer.append((const char*)BinaryDataFormat::signature, sizeof(BinaryDataFormat::signature));
+		buffer += (char)BinaryDataFormat::version;
+
+		WriteVarInt(mNames.Count());
+		for (auto& name : mNames)
+			WriteString(name.Data(), name.Length());
+
+		WriteValue(document);
+	}
+
+	void BinaryDataDocumentWriter::CollectNames(const DataValue& value)
+	{
+		if (value.IsObject())
+		{
+			for (auto it = value.BeginMember(); it != value.EndMember(); ++it)
+			{
+				String name = std::string(it->name.GetString(), it->name.GetStringLength());
+				if (mNamesIndexes.find(name) == mNamesIndexes.end())
+				{
+					mNamesIndexes[name] = mNames.Count();
+					mNames.Add(name);
+				}
+
+				CollectNames(it->value);
+			}
+		}
+		else if (value.IsArray())
+		{
+			for (auto& element : value)
+				CollectNames(element);
+		}
+	}
+
+	void BinaryDataDocumentWriter::WriteVarInt(UInt64 value)
+	{
+		while (value >= 0x80)
+		{
+			buffer += (char)((value & 0x7f) | 0x80);
+			value >>= 7;
+		}
+
+		buffer += (char)value;
+	}
+
+	void BinaryDataDocumentWriter::WriteString(const char* string, size_t length)
+	{
+		WriteVarInt(length);
+		buffer.append(string, length);
+		buffer += '\0';
+	}
+
+	void BinaryDataDocumentWriter::WriteValue(const DataValue& value)
+	{
+		typedef DataValue::Flags Flags;
+		typedef BinaryDataFormat::Tag Tag;
+
+		auto& flags = value.mData.flagsData;
+
+		if (value.IsObject())
+		{
+			buffer += (char)Tag::Object;
+			WriteVarInt(value.mData.objectData.count);
+
+			for (auto it = value.BeginMember(); it != value.EndMember(); ++it)
+			{
+				String name = std::string(it->name.GetString(), it->name.GetStringLength());
+				WriteVarInt(mNamesIndexes[name]);
+				WriteValue(it->value);
+			}
+		}
+		else if (value.IsArray())
+		{
+			buffer += (char)Tag::Array;
+			WriteVarInt(value.mData.arrayData.count);
+
+			for (auto& element : value)
+				WriteValue(element);
+		}
+		else if (value.IsString())
+		{
+			buffer += (char)Tag::String;
+			WriteString(value.GetString(), value.GetStringLength());
+		}
+		else if (flags.Is(Flags::Int) || flags.Is(Flags::Int64))
+		{
+			Int64 number = flags.Is(Flags::Int) ? value.mData.intData.intValue : value.mData.int64Data.intValue;
+			buffer += (char)(flags.Is(Flags::Int) ? Tag::Int : Tag::Int64);
+			WriteVarInt(((UInt64)number << 1) ^ (UInt64)(number >> 63));
+		}
+		else if (flags.Is(Flags::UInt))
+		{
+			buffer += (char)Tag::UInt;
+			WriteVarInt(value.mData.intData.uintValue);
+		}
+		else if (flags.Is(Flags::UInt64))
+		{
+			buffer += (char)Tag::UInt64;
+			WriteVarInt(value.mData.int64Data.uintValue);
+		}
+		else if (flags.Is(Flags::Double))
+		{
+			buffer += (char)Tag::Double;
+			buffer.append((const char*)&value.mData.doubleData.value, sizeof(double));
+		}
+		else if (flags.Is(Flags::BoolTrue))
+		{
+			buffer += (char)Tag::True;
+		}
+		else if (flags.Is(Flags::BoolFalse))
+		{
+			buffer += (char)Tag::False;
+		}
+		else
+		{
+			buffer += (char)Tag::Null;
+		}
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "DataValue.h"
+
+namespace o2
+{
+	// Parses binary document into DataDocument. It uses "Insitu" parse method: strings will be referenced to buffer,
+	// so buffer must live as long as document. Usually buffer is allocated from document's allocator
+	bool ParseBinaryInplace(char* data, size_t size, DataDocument& document);
+
+	// Parses binary document into DataDocument
+	bool ParseBinary(const char* data, size_t size, DataDocument& document);
+
+	// Writes data into binary string
+	void WriteBinary(String& str, const DataDocument& document);
+
+	// Returns true when data begins with binary document signature
+	bool IsBinaryData(const char* data, size_t size);
+
+	// ---------------------------------------------------------------------------------------------------
+	// Binary data document format. Document is stored as signature, members names strings table and values
+	// tree. Each value begins with type tag, integers and lengths are stored as varints, signed integers
+	// are zigzag encoded. Object members names are stored as indexes in strings table
+	// ---------------------------------------------------------------------------------------------------
+	class BinaryDataFormat
+	{
+	public:
+		static constexpr UInt8 signature[4] = { 'o', '2', 'B', 'D' }; // Binary document signature
+		static constexpr UInt8 version = 1;                            // Binary format version
+
+		enum class Tag : UInt8 { Null, False, True, Int, UInt, Int64, UInt64, Double, String, Object, Array };
+	};
+
+	// --------------------------------------------------------------------
+	// Binary data document reader. Builds DataDocument DOM structure
+	// --------------------------------------------------------------------
+	class BinaryDataDocumentReader
+	{
+	public:
+		DataDocument& document;
+
+	public:
+		// Constructor. When isInplace is true, strings are referenced to data buffer
+		BinaryDataDocumentReader(const char* data, size_t size, bool isInplace, DataDocument& document);
+
+		// Reads whole document. Returns false when data is corrupted
+		bool Read();
+
+	protected:
+		// ------------------------------
+		// Member name from strings table
+		// ------------------------------
+		struct Name
+		{
+			const char* string = nullptr; // Null terminated string, referenced to data buffer or document's allocator
+			int         length = 0;       // String length
+		};
+
+	protected:
+		const UInt8* mData;      // Current reading position
+		const UInt8* mDataEnd;   // End of data
+		bool        mIsInplace; // Are strings referenced to data buffer
+
+		Vector<Name> mNames; // Members names from strings table
+
+	protected:
+		// Reads varint. Returns false when data is corrupted
+		bool ReadVarInt(UInt64& value);
+
+		// Reads null terminated string with length prefix into value
+		bool ReadString(DataValue& value);
+
+		// Reads value into already constructed DataValue
+		bool ReadValue(DataValue& value);
+	};
+
+	// --------------------------------------------------------------------
+	// Binary data document writer
+	// --------------------------------------------------------------------
+	class BinaryDataDocumentWriter
+	{
+	public:
+		String& buffer;
+
+	public:
+		// Constructor
+		BinaryDataDocumentWriter(String& buffer);
+
+		// Writes whole document into buffer
+		void Write(const DataDocument& document);
+
+	protected:
+		Map<String, UInt> mNamesIndexes; // Members names indexes in strings table
+		Vector<String>    mNames;        // Members names in strings table order
+
+	protected:
+		// Collects object members names into strings table
+		void CollectNames(const DataValue& value);
+
+		// Writes varint
+		void WriteVarInt(UInt64 value);
+
+		// Writes string with length prefix and null terminator
+		void WriteString(const char* string, size_t length);
+
+		// Writes value
+		void WriteValue(const DataValue& value);
+	};
+}
@@ -2,7 +2,9 @@
 #include "DataValue.h"
 
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
+#include "o2/Utils/Tools/Hash.h"
 
 #include "rapidjson/document.h"
 
@@ -71,6 +73,101 @@ namespace o2
 		mData.stringPtrData.stringLength = strlen(stringRef);
 	}
 
+	DataMember* DataValue::SearchMember(const DataValue& name) const
+	{
+		if (!IsObject())
+			return nullptr;
+
+		MembersIndex* index = GetMembersIndex();
+		if (index && index->buckets && name.IsString())
+		{
+			UInt mask = index->bucketsCount - 1;
+			for (UInt i = GetMemberNameHash(name) & mask; index->buckets[i] != 0; i = (i + 1) & mask)
+			{
+				DataMember* member = mData.objectData.members + index->buckets[i] - 1;
+				if (member->name == name)
+					return member;
+			}
+
+			return nullptr;
+		}
+
+		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
+		{
+			if (memberIt->name == name)
+				return const_cast<DataMember*>(&*memberIt);
+		}
+
+		return nullptr;
+	}
+
+	DataValue::MembersIndex* DataValue::GetMembersIndex() const
+	{
+		if (!mData.flagsData.Is(Flags::MembersIndex))
+			return nullptr;
+
+		return (MembersIndex*)((Byte*)mData.objectData.members - sizeof(MembersIndex));
+	}
+
+	void DataValue::UpdateMembersIndex()
+	{
+		static_assert(sizeof(MembersIndex) % alignof(DataMember) == 0, "Members index breaks members alignment");
+
+		MembersIndex* index = GetMembersIndex();
+
+		if (mData.objectData.count < MembersIndexThreshold)
+		{
+			if (index)
+				index->buckets = nullptr;
+
+			return;
+		}
+
+		// Index is placed before members, so members are moved once into new allocation
+		if (!index)
+		{
+			Byte* memory = (Byte*)mDocument->mAllocator.Allocate(sizeof(MembersIndex) + sizeof(DataMember)*mData.objectData.capacity);
+			memcpy(memory + sizeof(MembersIndex), mData.objectData.members, sizeof(DataMember)*mData.objectData.count);
+
+			index = (MembersIndex*)memory;
+			index->buckets = nullptr;
+			index->bucketsCount = 0;
+
+			mData.objectData.members = (DataMember*)(memory + sizeof(MembersIndex));
+			mData.flagsData.flags = mData.flagsData.flags | Flags::MembersIndex;
+		}
+
+		UInt bucketsCount = MembersIndexThreshold*2;
+		while (bucketsCount < mData.objectData.count*2)
+			bucketsCount *= 2;
+
+		if (!index->buckets || index->bucketsCount < bucketsCount)
+		{
+			index->bucketsCount = bucketsCount;
+			index->buckets = (UInt*)mDocument->mAllocator.Allocate(sizeof(UInt)*index->bucketsCount);
+		}
+
+		memset(index->buckets, 0, sizeof(UInt)*index->bucketsCount);
+
+		for (UInt i = 0; i < mData.objectData.count; i++)
+			AddToMembersIndex(index, i);
+	}
+
+	void DataValue::AddToMembersIndex(MembersIndex* index, UInt memberIdx) const
+	{
+		UInt mask = index->bucketsCount - 1;
+		UInt i = GetMemberNameHash(mData.objectData.members[memberIdx].name) & mask;
+		while (index->buckets[i] != 0)
+			i = (i + 1) & mask;
+
+		index->buckets[i] = memberIdx + 1;
+	}
+
+	UInt DataValue::GetMemberNameHash(const DataValue& name)
+	{
+		return (UInt)GetFNV1aHash(name.GetString(), name.GetStringLength());
+	}
+
 	bool DataValue::Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF8<>>& target, const wchar_t* source)
 	{
 		rapidjson::GenericStringStream<rapidjson::UTF16<>> sourceStream(source);
@@ -401,28 +498,16 @@ namespace o2
 
 	DataValue* DataValue::FindMember(const DataValue& name)
 	{
-		if (!IsObject())
-			return nullptr;
-
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
-		{
-			if (memberIt->name == name)
-				return &memberIt->value;
-		}
+		if (auto member = SearchMember(name))
+			return &member->value;
 
 		return nullptr;
 	}
 
 	const DataValue* DataValue::FindMember(const DataValue& name) const
 	{
-		if (!IsObject())
-			return nullptr;
-
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
-		{
-			if (memberIt->name == name)
-				return &memberIt->value;
-		}
+		if (auto member = SearchMember(name))
+			return &member->value;
 
 		return nullptr;
 	}
@@ -455,7 +540,17 @@ namespace o2
 
 		if (mData.objectData.count == mData.objectData.capacity)
 		{
-			if (mData.objectData.members)
+			if (MembersIndex* index = GetMembersIndex())
+			{
+				UInt newCapacity = mData.objectData.capacity*2;
+				Byte* memory = (Byte*)mDocument->mAllocator.Reallocate(
+					index, sizeof(MembersIndex) + sizeof(DataMember)*mData.objectData.capacity,
+					sizeof(MembersIndex) + sizeof(DataMember)*newCapacity);
+
+				mData.objectData.members = (DataMember*)(memory + sizeof(MembersIndex));
+				mData.objectData.capacity = newCapacity;
+			}
+			else if (mData.objectData.members)
 			{
 				UInt newCapacity = Math::Max(mData.objectData.capacity*2, ObjectInitialCapacity);
 				mData.objectData.members = (DataMember*)mDocument->mAllocator.Reallocate(
@@ -471,12 +566,19 @@ namespace o2
 			}
 		}
 
-		DataMember* newMember =
-			new (mData.objectData.members + mData.objectData.count) DataMember(name, DataValue(*mDocument));
+		DataValue value(*mDocument);
+		new (mData.objectData.members + mData.objectData.count) DataMember(name, value);
 
 		mData.objectData.count++;
 
-		return newMember->value;
+		// Updating index can move members, so new member is taken after it
+		MembersIndex* index = GetMembersIndex();
+		if (index && index->buckets && mData.objectData.count*2 <= index->bucketsCount)
+			AddToMembersIndex(index, mData.objectData.count - 1);
+		else if (mData.objectData.count >= MembersIndexThreshold)
+			UpdateMembersIndex();
+
+		return mData.objectData.members[mData.objectData.count - 1].value;
 	}
 
 	DataValue& DataValue::AddMember(const char* name)
@@ -489,14 +591,11 @@ namespace o2
 	{
 		Assert(IsObject(), "Trying remove member, but value isn't object");
 
-		for (auto memberIt = BeginMember(); memberIt != EndMember(); ++memberIt)
+		if (DataMember* member = SearchMember(name))
 		{
-			if (memberIt->name == name)
-			{
-				*memberIt = *(mData.objectData.members + mData.objectData.count - 1);
-				mData.objectData.count--;
-				break;
-			}
+			*member = *(mData.objectData.members + mData.objectData.count - 1);
+			mData.objectData.count--;
+			UpdateMembersIndex();
 		}
 	}
 
@@ -507,6 +606,7 @@ namespace o2
 
 		*it = *(mData.objectData.members + mData.objectData.count - 1);
 		mData.objectData.count--;
+		UpdateMembersIndex();
 
 		return it;
 	}
@@ -789,7 +889,10 @@ namespace o2
 	void DataValue::Clear()
 	{
 		if (IsObject())
+		{
 			mData.objectData.count = 0;
+			UpdateMembersIndex();
+		}
 		else if (IsArray())
 			mData.arrayData.count = 0;
 		else
@@ -846,17 +949,30 @@ namespace o2
 		char* data = (char*)mAllocator.Allocate(size);
 		file.ReadData(data, size);
 
+		// Binary documents are recognized by signature, so built binary data can replace json files transparently
+		if (IsBinaryData(data, size))
+			format = Format::Binary;
+
 		if (format == Format::JSON)
 			return ParseJsonInplace(data, *this);
 
+		if (format == Format::Binary)
+			return ParseBinaryInplace(data, size, *this);
+
 		return false;
 	}
 
 	bool DataDocument::LoadFromData(const String& data, Format format /*= Format::JSON*/)
 	{
+		if (IsBinaryData(data.Data(), data.Length()))
+			format = Format::Binary;
+
 		if (format == Format::JSON)
 			return ParseJson(data.Data(), *this);
 
+		if (format == Format::Binary)
+			return ParseBinary(data.Data(), data.Length(), *this);
+
 		return false;
 	}
 
@@ -882,6 +998,13 @@ namespace o2
 			return buf;
 		}
 
+		if (format == Format::Binary)
+		{
+			String buf;
+			WriteBinary(buf, *this);
+			return buf;
+		}
+
 		return "";
 		//return XmlDataFormat::SaveDataDoc(*this);
 	}
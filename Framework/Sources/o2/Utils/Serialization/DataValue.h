@@ -1,7 +1,6 @@
 #pragma once
 
 #include "o2/Utils/Memory/Allocators/ChunkPoolAllocator.h"
-#include "o2/Utils/Property.h"
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
@@ -14,8 +13,13 @@
 namespace o2
 {
 	class DataDocument;
+	class ISerializable;
+	class SerializableAttribute;
 	struct DataMember;
 
+	template<typename _type>
+	class TType;
+
 	template <bool _const>
 	class BaseMemberIterator;
 
@@ -295,7 +299,9 @@ namespace o2
 
 			ShortString = 1 << 13,
 			StringRef = 1 << 14,
-			StringCopy = 1 << 15
+			StringCopy = 1 << 15,
+
+			MembersIndex = 1 << 16
 		};
 
 	protected:
@@ -305,6 +311,8 @@ namespace o2
 		static constexpr UInt ObjectInitialCapacity = 7;
 		static constexpr UInt ArrayInitialCapacity = 7;
 
+		static constexpr UInt MembersIndexThreshold = 16; // Members count, from which members are searched by hash index
+
 		struct IntData
 		{
 			int intValue;
@@ -357,6 +365,13 @@ namespace o2
 			UInt capacity;
 		};
 
+		// Members hash index. Located in document's allocator right before members array, when Flags::MembersIndex is set
+		struct MembersIndex
+		{
+			UInt* buckets;      // Open addressing hash buckets with member index + 1, zero is empty. Null when object is too small for index
+			UInt  bucketsCount; // Buckets count, power of two
+		};
+
 		struct ArrayData
 		{
 			DataValue* elements;
@@ -387,12 +402,30 @@ namespace o2
 		// Constructor temporary string reference
 		explicit DataValue(const char* stringRef);
 
+		// Searches member by name. Uses hash index for large objects
+		DataMember* SearchMember(const DataValue& name) const;
+
+		// Returns members hash index, or null when object has no index
+		MembersIndex* GetMembersIndex() const;
+
+		// Rebuilds members hash index after members changing. Moves members into allocation with index at first building.
+		// Index is built only here, so searching members never modifies value and can be done from several threads
+		void UpdateMembersIndex();
+
+		// Adds member into index buckets
+		void AddToMembersIndex(MembersIndex* index, UInt memberIdx) const;
+
+		// Returns member name hash
+		static UInt GetMemberNameHash(const DataValue& name);
+
 		// Transcode wide char to char
 		static bool Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF8<>>& target, const wchar_t* source);
 
 		// Transcode char to wide char
 		static bool Transcode(rapidjson::GenericStringBuffer<rapidjson::UTF16<>>& target, const char* source);
 
+		friend class BinaryDataDocumentReader;
+		friend class BinaryDataDocumentWriter;
 		friend class JsonDataDocumentParseHandler;
 		friend class TType<DataValue>;
 	};
@@ -438,10 +471,10 @@ namespace o2
 		template<typename _type>
 		DataDocument& operator=(const _type& value);
 
-		// Loads data structure from file
+		// Loads data structure from file. Binary data is detected by signature regardless of format
 		bool LoadFromFile(const String& fileName, Format format = Format::JSON);
 
-		// Loads data structure from string
+		// Loads data structure from string. Binary data is detected by signature regardless of format
 		bool LoadFromData(const String& data, Format format = Format::JSON);
 
 		// Saves data to file with specified format
@@ -453,6 +486,7 @@ namespace o2
 	protected:
 		ChunkPoolAllocator mAllocator;
 
+		friend class BinaryDataDocumentReader;
 		friend class DataValue;
 		friend class JsonDataDocumentParseHandler;
 	};
@@ -501,11 +535,11 @@ namespace o2
 
 		BaseMemberIterator<_const>& operator++() { ++mPointer; return *this; }
 		BaseMemberIterator<_const>& operator--() { --mPointer; return *this; }
-		BaseMemberIterator<_const>  operator++(int) { Iterator old(*this); ++mPointer; return old; }
-		BaseMemberIterator<_const>  operator--(int) { Iterator old(*this); --mPointer; return old; }
+		BaseMemberIterator<_const>  operator++(int) { BaseMemberIterator old(*this); ++mPointer; return old; }
+		BaseMemberIterator<_const>  operator--(int) { BaseMemberIterator old(*this); --mPointer; return old; }
 
-		BaseMemberIterator<_const> operator+(int n) const { return Iterator(mPointer+n); }
-		BaseMemberIterator<_const> operator-(int n) const { return Iterator(mPointer-n); }
+		BaseMemberIterator<_const> operator+(int n) const { return BaseMemberIterator(mPointer+n); }
+		BaseMemberIterator<_const> operator-(int n) const { return BaseMemberIterator(mPointer-n); }
 
 		BaseMemberIterator<_const>& operator+=(int n) { mPointer += n; return *this; }
 		BaseMemberIterator<_const>& operator-=(int n) { mPointer -= n; return *this; }
@@ -534,9 +568,14 @@ namespace o2
 
 	DataValue::Flags operator&(const DataValue::Flags& a, const DataValue::Flags& b);
 	DataValue::Flags operator|(const DataValue::Flags& a, const DataValue::Flags& b);
+
+	template<typename _type>
+	struct IsDataValueSupports: DataValue::IsSupports<_type> {};
 }
 
+#include "o2/Utils/Property.h"
 #include "o2/Utils/Reflection/Reflection.h"
+#include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
 {
@@ -1192,16 +1231,16 @@ namespace o2
 	struct DataValue::Converter<T, typename std::enable_if<std::is_pointer<T>::value && !std::is_const<T>::value &&
 		!std::is_base_of<o2::IObject, typename std::remove_pointer<T>::type>::value && !std::is_same<void*, T>::value>::type>
 	{
-		static constexpr bool isSupported = DataValue::Converter<std::remove_pointer<T>::type>::isSupported;
+		static constexpr bool isSupported = DataValue::Converter<typename std::remove_pointer<T>::type>::isSupported;
 
 		static void Write(const T& value, DataValue& data)
 		{
-			DataValue::Converter<std::remove_pointer<T>::type>::Write(*value, data);
+			DataValue::Converter<typename std::remove_pointer<T>::type>::Write(*value, data);
 		}
 
 		static void Read(T& value, const DataValue& data)
 		{
-			DataValue::Converter<std::remove_pointer<T>::type>::Read(*value, data);
+			DataValue::Converter<typename std::remove_pointer<T>::type>::Read(*value, data);
 		}
 	};
 
@@ -1218,7 +1257,7 @@ namespace o2
 			data.mData.arrayData.capacity = 0;
 
 			for (auto& v : value)
-				data.AddElement(DataValue(v, *data.mDocument));
+				data.AddElement().Set(v);
 		}
 
 		static void Read(Vector<T>& value, const DataValue& data)
@@ -1300,7 +1339,7 @@ namespace o2
 	template<typename T>
 	struct DataValue::Converter<T, typename std::enable_if<IsProperty<T>::value>::type>
 	{
-		static constexpr bool isSupported = DataValue::IsSupports<T::valueType>::value;
+		static constexpr bool isSupported = DataValue::IsSupports<typename T::valueType>::value;
 		using TValueType = typename T::valueType;
 
 		static void Write(const T& value, DataValue& data)
@@ -1321,6 +1360,9 @@ namespace o2
 	{
 		static constexpr bool isSupported = true;
 
+		// Serializable interface, dependent on T because it is not complete yet when included from Serializable.h
+		using TSerializable = typename std::conditional<std::is_void<T>::value, T, ISerializable>::type;
+
 		static void Write(const T& value, DataValue& data)
 		{
 			struct helper
@@ -1347,7 +1389,7 @@ namespace o2
 			};
 
 			if (value.GetType().IsBasedOn(TypeOf(ISerializable)))
-				dynamic_cast<const ISerializable&>(value).OnSerialize(data);
+				dynamic_cast<const TSerializable&>(value).OnSerialize(data);
 
 			const ObjectType& type = dynamic_cast<const ObjectType&>(value.GetType());
 			void* objectPtr = type.DynamicCastFromIObject(const_cast<IObject*>(dynamic_cast<const IObject*>(&value)));
@@ -1357,6 +1399,13 @@ namespace o2
 
 		static void Read(T& value, const DataValue& data)
 		{
+			// Serializable objects are read by code generated from class meta, it falls back to reflection itself
+			if constexpr (std::is_base_of<ISerializable, T>::value)
+			{
+				value.Deserialize(data);
+				return;
+			}
+
 			struct helper
 			{
 				static void ReadObject(void* object, const ObjectType& type, const DataValue& node)
@@ -1389,7 +1438,7 @@ namespace o2
 			helper::ReadObject(objectPtr, type, data);
 
 			if (value.GetType().IsBasedOn(TypeOf(ISerializable)))
-				dynamic_cast<ISerializable&>(value).OnDeserialized(data);
+				dynamic_cast<TSerializable&>(value).OnDeserialized(data);
 		}
 	};
 }
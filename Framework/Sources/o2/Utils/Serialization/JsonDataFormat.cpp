@@ -131,6 +131,7 @@ namespace o2
 
 		top->mData.objectData.count = memberCount;
 		top->mData.objectData.capacity = memberCount;
+		top->UpdateMembersIndex();
 
 		return true;
 	}
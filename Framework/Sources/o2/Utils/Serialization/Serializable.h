@@ -61,7 +61,6 @@ namespace o2
 
 	class SerializationTypeProcessor
 	{
-		// !!! Remove attributes pointer!!!
 	public:
 		DataValue& node;
 
@@ -78,6 +77,9 @@ namespace o2
 		template<typename _object_type>
 		void StartBases(_object_type* object, Type* type) {}
 
+		template<typename _object_type, typename _attribute_type>
+		void ClassAttribute(_object_type* object, Type* type) {}
+
 		template<typename _object_type>
 		void StartFields(_object_type* object, Type* type) {}
 
@@ -92,6 +94,13 @@ namespace o2
 
 			template<typename _attribute_type>
 			FieldInfo& AddAttribute(_attribute_type* attribute)
+			{
+				delete attribute;
+				return AddAttribute<_attribute_type>();
+			}
+
+			template<typename _attribute_type>
+			FieldInfo& AddAttribute()
 			{
 				if constexpr (std::is_same<_attribute_type, SerializableAttribute>::value)
 					node.AddMember(name).Set(*fieldPtr);
@@ -110,6 +119,95 @@ namespace o2
 		}
 	};
 
+	// --------------------------------------------------------------------------------------------------------
+	// Deserialization type processor. Goes through class meta, generated by CodeTool, and reads serializable
+	// fields by their types known at compile time. Fields are usually stored in same order as they are
+	// processed, so next member is checked first, and only after it member is searched by name
+	// --------------------------------------------------------------------------------------------------------
+	class DeserializationTypeProcessor
+	{
+	public:
+		const DataValue& node;
+
+	public:
+		DeserializationTypeProcessor(const DataValue& node):node(node), nextMember(node.BeginMember()), endMember(node.EndMember()) {}
+
+		template<typename _object_type, typename _base_type>
+		void BaseType(_object_type* object, Type* type, const char* name)
+		{
+			if constexpr (std::is_base_of<IObject, _base_type>::value && !std::is_same<IObject, _base_type>::value)
+			{
+				_base_type::ProcessBaseTypes(object, *this);
+				_base_type::ProcessFields(object, *this);
+			}
+		}
+
+		template<typename _object_type>
+		void StartBases(_object_type* object, Type* type) {}
+
+		template<typename _object_type, typename _attribute_type>
+		void ClassAttribute(_object_type* object, Type* type) {}
+
+		template<typename _object_type>
+		void StartFields(_object_type* object, Type* type) {}
+
+		template<typename _field_type>
+		struct FieldInfo
+		{
+			_field_type*                  fieldPtr;
+			DeserializationTypeProcessor& processor;
+			const char*                   name;
+
+			FieldInfo(_field_type* fieldPtr, DeserializationTypeProcessor& processor, const char* name):
+				fieldPtr(fieldPtr), processor(processor), name(name) {}
+
+			template<typename _attribute_type>
+			FieldInfo& AddAttribute(_attribute_type* attribute)
+			{
+				delete attribute;
+				return AddAttribute<_attribute_type>();
+			}
+
+			template<typename _attribute_type>
+			FieldInfo& AddAttribute()
+			{
+				if constexpr (std::conjunction<std::is_same<_attribute_type, SerializableAttribute>, DataValue::IsSupports<_field_type>>::value)
+				{
+					if (auto fieldNode = processor.FindMember(name))
+						fieldNode->Get(*fieldPtr);
+				}
+
+				return *this;
+			}
+
+			FieldInfo& SetDefaultValue(const _field_type& val) { return *this; }
+		};
+
+		template<typename _object_type, typename _field_type>
+		FieldInfo<_field_type> Field(_object_type* object, Type* type, const char* name, void*(*pointerGetter)(void*), _field_type& field, ProtectSection protection)
+		{
+			_field_type* fieldPtr = (_field_type*)((*pointerGetter)(object));
+			return FieldInfo<_field_type>(fieldPtr, *this, name);
+		}
+
+		// Returns member by name. Checks next member after previous found, then searches by name
+		const DataValue* FindMember(const char* name)
+		{
+			if (nextMember != endMember && strcmp(nextMember->name.GetString(), name) == 0)
+			{
+				const DataValue* res = &nextMember->value;
+				++nextMember;
+				return res;
+			}
+
+			return node.FindMember(name);
+		}
+
+	protected:
+		ConstDataMemberIterator nextMember; // Expected next member, fields are usually stored in processing order
+		ConstDataMemberIterator endMember;  // End of members
+	};
+
 	// Serialization implementation macros
 #define SERIALIZABLE_MAIN(CLASS)  							                                                    \
     IOBJECT_MAIN(CLASS)																							\
@@ -122,7 +220,16 @@ namespace o2
 	}												                                                            \
     void Deserialize(const o2::DataValue& node) override                                                        \
     {												                                                            \
-        DeserializeBasic(*this, node);                                                                          \
+		if (&GetType() != type || !node.IsObject())                                                             \
+		{                                                                                                       \
+			DeserializeBasic(*this, node);                                                                      \
+			return;                                                                                             \
+		}                                                                                                       \
+                                                                                                                \
+		DeserializationTypeProcessor p(node);                                                                   \
+		ProcessBaseTypes(this, p);                                                                              \
+		ProcessFields(this, p);                                                                                 \
+		OnDeserialized(node);                                                                                   \
 	}												                                                            \
 	CLASS& operator=(const o2::DataValue& node) 		                                                        \
 	{												                                                            \
@@ -146,7 +253,7 @@ namespace o2
     SERIALIZABLE(CLASS)
 
 #define SERIALIZABLE_ATTRIBUTE() \
-    AddAttribute(new SerializableAttribute())
+    template AddAttribute<SerializableAttribute>()
 }
 
 CLASS_BASES_META(o2::ISerializable)
@@ -8,6 +8,9 @@
 
 namespace o2
 {
+#if defined PLATFORM_LINUX
+	static WString headlessClipboardText; // Process local clipboard, there is no system clipboard in headless mode
+#endif
 
 	void Clipboard::SetText(const WString& text)
 	{
@@ -24,6 +27,8 @@ namespace o2
 			SetClipboardData(CF_UNICODETEXT, hgBuffer);
 			CloseClipboard();
 		}
+#elif defined PLATFORM_LINUX
+		headlessClipboardText = text;
 #endif
 	}
 
@@ -42,6 +47,8 @@ namespace o2
 		}
 
 		return res;
+#elif defined PLATFORM_LINUX
+		return headlessClipboardText;
 #elif PLATFORM_ANDROID
         return WString();
 #endif
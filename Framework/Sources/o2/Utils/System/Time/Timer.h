@@ -8,6 +8,10 @@
 #include <sys/time.h>
 #endif
 
+#ifdef PLATFORM_LINUX
+#include <time.h>
+#endif
+
 #include <stdio.h>
 
 namespace o2
@@ -44,6 +48,11 @@ namespace o2
 		struct timeval mLastElapsedTime;
 		struct timeval mStartTime;
 #endif
+
+#ifdef PLATFORM_LINUX
+		struct timespec mLastElapsedTime;
+		struct timespec mStartTime;
+#endif
 	};
 
 	class ScopeTimer
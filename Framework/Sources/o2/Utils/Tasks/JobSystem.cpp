@@ -0,0 +1,262 @@
+#include "o2/stdafx.h"
+#include "JobSystem.h"
+
+#include "o2/Utils/Math/Math.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(JobSystem);
+
+	static thread_local int jobsQueueIndex = 0; // Index of current thread jobs queue. Non-worker threads are using first queue
+
+	Job::Job(const Function<void()>& function, JobCounter* counter):
+		function(function), counter(counter)
+	{}
+
+	JobCounter::~JobCounter()
+	{
+		Wait();
+
+		// Wait until last decrementing thread releases counter
+		std::lock_guard<std::mutex> lock(mDependentsMutex);
+	}
+
+	int JobCounter::GetValue() const
+	{
+		return mValue;
+	}
+
+	bool JobCounter::IsDone() const
+	{
+		return mValue == 0;
+	}
+
+	void JobCounter::Wait()
+	{
+		if (!IsDone())
+			o2Jobs.Wait(*this);
+	}
+
+	void JobCounter::Increment()
+	{
+		mValue++;
+	}
+
+	void JobCounter::Decrement()
+	{
+		Vector<Job> dependents;
+
+		{
+			std::lock_guard<std::mutex> lock(mDependentsMutex);
+
+			if (--mValue > 0)
+				return;
+
+			dependents.swap(mDependents);
+		}
+
+		for (auto& job : dependents)
+			o2Jobs.Schedule(job);
+	}
+
+	void JobCounter::AddDependent(const Job& job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mDependentsMutex);
+
+			if (mValue > 0)
+			{
+				mDependents.Add(job);
+				return;
+			}
+		}
+
+		o2Jobs.Schedule(job);
+	}
+
+	JobSystem::JobSystem()
+	{
+		int workersCount = GetJobSystemWorkersCount();
+		if (workersCount < 0)
+			workersCount = Math::Max((int)std::thread::hardware_concurrency() - 1, 1);
+
+		for (int i = 0; i < workersCount + 1; i++)
+			mQueues.Add(mnew JobsQueue());
+
+		for (int i = 0; i < workersCount; i++)
+			mWorkers.Add(mnew std::thread(&JobSystem::WorkerThread, this, i + 1));
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mStopping = true;
+		}
+
+		mSleepCondition.notify_all();
+
+		for (auto worker : mWorkers)
+		{
+			worker->join();
+			delete worker;
+		}
+
+		for (auto queue : mQueues)
+			delete queue;
+	}
+
+	void JobSystem::Run(const Function<void()>& function, JobCounter* counter /*= nullptr*/)
+	{
+		if (counter)
+			counter->Increment();
+
+		Schedule(Job(function, counter));
+	}
+
+	void JobSystem::RunAfter(JobCounter& dependency, const Function<void()>& function, JobCounter* counter /*= nullptr*/)
+	{
+		if (counter)
+			counter->Increment();
+
+		dependency.AddDependent(Job(function, counter));
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			Job job;
+			if (TakeJob(job))
+				Execute(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::ParallelFor(int count, const Function<void(int, int)>& function, int minBatchSize /*= 1*/)
+	{
+		if (count <= 0)
+			return;
+
+		minBatchSize = Math::Max(minBatchSize, 1);
+
+		// Few batches per thread for balancing uneven batches
+		int batchesCount = Math::Min((count + minBatchSize - 1)/minBatchSize, (GetWorkersCount() + 1)*4);
+		if (batchesCount <= 1)
+		{
+			function(0, count);
+			return;
+		}
+
+		int batchSize = count/batchesCount;
+		int remainder = count%batchesCount;
+
+		JobCounter counter;
+		int begin = batchSize + (remainder > 0 ? 1 : 0);
+		for (int i = 1; i < batchesCount; i++)
+		{
+			int end = begin + batchSize + (i < remainder ? 1 : 0);
+			Run([&function, begin, end]() { function(begin, end); }, &counter);
+			begin = end;
+		}
+
+		// First batch is processed by calling thread
+		function(0, batchSize + (remainder > 0 ? 1 : 0));
+
+		Wait(counter);
+	}
+
+	int JobSystem::GetWorkersCount() const
+	{
+		return mWorkers.Count();
+	}
+
+	bool JobSystem::IsWorkerThread() const
+	{
+		return jobsQueueIndex > 0;
+	}
+
+	void JobSystem::Schedule(const Job& job)
+	{
+		JobsQueue* queue = mQueues[jobsQueueIndex];
+
+		mPendingJobsCount++;
+
+		{
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			queue->jobs.push_back(job);
+		}
+
+		// Synchronize with worker going to sleep, so notification isn't lost
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+
+		mSleepCondition.notify_one();
+	}
+
+	bool JobSystem::TakeJob(Job& job)
+	{
+		if (mPendingJobsCount == 0)
+			return false;
+
+		// Own queue back is most recently scheduled job, it's data most likely is in cache
+		JobsQueue* ownQueue = mQueues[jobsQueueIndex];
+
+		{
+			std::lock_guard<std::mutex> lock(ownQueue->mutex);
+			if (!ownQueue->jobs.empty())
+			{
+				job = std::move(ownQueue->jobs.back());
+				ownQueue->jobs.pop_back();
+				mPendingJobsCount--;
+				return true;
+			}
+		}
+
+		// Steal oldest job from other queues
+		int queuesCount = mQueues.Count();
+		for (int i = 1; i < queuesCount; i++)
+		{
+			JobsQueue* queue = mQueues[(jobsQueueIndex + i)%queuesCount];
+
+			std::lock_guard<std::mutex> lock(queue->mutex);
+			if (!queue->jobs.empty())
+			{
+				job = std::move(queue->jobs.front());
+				queue->jobs.pop_front();
+				mPendingJobsCount--;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void JobSystem::Execute(Job& job)
+	{
+		job.function();
+
+		if (job.counter)
+			job.counter->Decrement();
+	}
+
+	void JobSystem::WorkerThread(int index)
+	{
+		jobsQueueIndex = index;
+
+		while (!mStopping)
+		{
+			Job job;
+			if (TakeJob(job))
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [&]() { return mStopping || mPendingJobsCount > 0; });
+		}
+	}
+}
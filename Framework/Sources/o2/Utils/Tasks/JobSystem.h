@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "o2/Utils/Function.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+// Job system access macros
+#define o2Jobs o2::JobSystem::Instance()
+
+namespace o2
+{
+	class JobCounter;
+
+	// ------------------------------------------------------------------------------
+	// Job: function to execute on any worker thread and counter to decrement when done
+	// ------------------------------------------------------------------------------
+	struct Job
+	{
+		Function<void()> function;          // Job function
+		JobCounter*      counter = nullptr; // Counter, decrements when job is done. Can be null
+
+	public:
+		// Default constructor
+		Job() = default;
+
+		// Constructor
+		Job(const Function<void()>& function, JobCounter* counter);
+	};
+
+	// ---------------------------------------------------------------------------------------------
+	// Jobs counter. Counts unfinished jobs; used for waiting jobs and as dependency for other jobs.
+	// Jobs scheduled with RunAfter() are started when counter becomes zero. Counter must live until
+	// all counted jobs and dependent jobs are started
+	// ---------------------------------------------------------------------------------------------
+	class JobCounter
+	{
+	public:
+		// Default constructor
+		JobCounter() = default;
+
+		// Destructor. Waits counted jobs
+		~JobCounter();
+
+		// Returns count of unfinished jobs
+		int GetValue() const;
+
+		// Returns true when all counted jobs are done
+		bool IsDone() const;
+
+		// Waits until all counted jobs are done. Waiting thread executes other jobs while waiting
+		void Wait();
+
+	protected:
+		std::atomic<int> mValue { 0 };     // Count of unfinished jobs
+		Vector<Job>      mDependents;      // Jobs to start when counter becomes zero
+		std::mutex       mDependentsMutex; // Counter decrementing and dependents list mutex
+
+	protected:
+		// Increments counter, it is called when job is scheduled
+		void Increment();
+
+		// Decrements counter, it is called when job is done. Schedules dependent jobs when counter becomes zero
+		void Decrement();
+
+		// Adds job to start when counter becomes zero. Schedules it immediately when counter is already zero
+		void AddDependent(const Job& job);
+
+		friend class JobSystem;
+	};
+
+	// -------------------------------------------------------------------------------------------------
+	// Multithreaded work-stealing job system. Each worker thread has own jobs deque: owner takes jobs from
+	// back, other workers steal jobs from front when own deque is empty. Main thread and other non-worker
+	// threads share one deque and help executing jobs while waiting counters
+	// -------------------------------------------------------------------------------------------------
+	class JobSystem: public Singleton<JobSystem>
+	{
+	public:
+		// Runs job on any worker thread. Counter is incremented now and decremented when job is done
+		void Run(const Function<void()>& function, JobCounter* counter = nullptr);
+
+		// Runs job when all dependency jobs are done. Counter is incremented now and decremented when job is done
+		void RunAfter(JobCounter& dependency, const Function<void()>& function, JobCounter* counter = nullptr);
+
+		// Waits until all counted jobs are done. Waiting thread executes other jobs while waiting
+		void Wait(JobCounter& counter);
+
+		// Splits range [0, count) into batches not smaller than minBatchSize and processes them in parallel.
+		// Function receives batch range [begin, end). Returns when all batches are processed
+		void ParallelFor(int count, const Function<void(int, int)>& function, int minBatchSize = 1);
+
+		// Returns count of worker threads, main thread isn't included
+		int GetWorkersCount() const;
+
+		// Returns true when current thread is worker thread
+		bool IsWorkerThread() const;
+
+	protected:
+		// -------------------------------------------------
+		// Jobs queue of thread. Protected by mutex
+		// -------------------------------------------------
+		struct JobsQueue
+		{
+			std::deque<Job> jobs;  // Jobs deque
+			std::mutex      mutex; // Deque mutex
+		};
+
+		Vector<JobsQueue*>   mQueues;  // Jobs queues. First queue is for non-worker threads, others for workers by index
+		Vector<std::thread*> mWorkers; // Worker threads
+
+		std::atomic<int>        mPendingJobsCount { 0 }; // Count of jobs in queues, used for sleeping idle workers
+		std::atomic<bool>       mStopping { false };     // True when workers must be stopped
+		std::mutex              mSleepMutex;             // Idle workers sleep mutex
+		std::condition_variable mSleepCondition;         // Idle workers wake up condition
+
+	protected:
+		// Default constructor. Starts worker threads
+		JobSystem();
+
+		// Destructor. Stops worker threads, not started jobs are dropped
+		~JobSystem();
+
+		// Pushes job into current thread queue and wakes up one idle worker
+		void Schedule(const Job& job);
+
+		// Takes job from own queue back or steals from other queues fronts. Returns false when there is no jobs
+		bool TakeJob(Job& job);
+
+		// Executes job and decrements its counter
+		void Execute(Job& job);
+
+		// Worker thread function
+		void WorkerThread(int index);
+
+		friend class Application;
+		friend class JobCounter;
+	};
+}
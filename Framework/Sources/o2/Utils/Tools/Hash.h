@@ -0,0 +1,22 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+
+namespace o2
+{
+	// Initial value of 64 bit FNV-1a hash
+	constexpr UInt64 FNV1aHashBasis = 14695981039346656037ull;
+
+	// Returns 64 bit FNV-1a hash of data. Continues passed hash, so several data blocks can be hashed together
+	inline UInt64 GetFNV1aHash(const void* data, UInt size, UInt64 hash = FNV1aHashBasis)
+	{
+		const UInt8* bytes = (const UInt8*)data;
+		for (UInt i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+}
@@ -42,7 +42,7 @@ namespace o2
 
 	enum class ProtectSection { Public, Private, Protected };
 
-	enum class Platform { Windows, MacOSX, iOS, Android };
+	enum class Platform { Windows, MacOSX, iOS, Android, Linux };
 
 	enum class LineType { Solid, Dash };
 
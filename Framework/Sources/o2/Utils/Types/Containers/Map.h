@@ -17,6 +17,19 @@ namespace o2
 		using Iterator = typename std::map<_key_type, _value_type>::iterator;
 		using ConstIterator = typename std::map<_key_type, _value_type>::const_iterator;
 
+		using std::map<_key_type, _value_type>::begin;
+		using std::map<_key_type, _value_type>::cbegin;
+		using std::map<_key_type, _value_type>::cend;
+		using std::map<_key_type, _value_type>::clear;
+		using std::map<_key_type, _value_type>::empty;
+		using std::map<_key_type, _value_type>::end;
+		using std::map<_key_type, _value_type>::erase;
+		using std::map<_key_type, _value_type>::find;
+		using std::map<_key_type, _value_type>::insert;
+		using std::map<_key_type, _value_type>::rbegin;
+		using std::map<_key_type, _value_type>::rend;
+		using std::map<_key_type, _value_type>::size;
+
 	public:
 		// Default constructor
 		Map();
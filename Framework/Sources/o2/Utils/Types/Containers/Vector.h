@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Utils/Debug/Assert.h"
+#include "o2/Utils/Math/Math.h"
 #include "o2/Utils/Memory/MemoryManager.h"
 #include <vector>
 #include <algorithm>
@@ -17,6 +18,22 @@ namespace o2
 		typedef typename std::vector<_type>::iterator Iterator;
 		typedef typename std::vector<_type>::const_iterator ConstIterator;
 
+		using std::vector<_type>::at;
+		using std::vector<_type>::back;
+		using std::vector<_type>::begin;
+		using std::vector<_type>::cbegin;
+		using std::vector<_type>::cend;
+		using std::vector<_type>::clear;
+		using std::vector<_type>::empty;
+		using std::vector<_type>::end;
+		using std::vector<_type>::erase;
+		using std::vector<_type>::front;
+		using std::vector<_type>::insert;
+		using std::vector<_type>::rbegin;
+		using std::vector<_type>::rend;
+		using std::vector<_type>::shrink_to_fit;
+		using std::vector<_type>::size;
+
 	public:
 		// Constructor by initial capacity
 		Vector();
@@ -233,10 +250,10 @@ namespace o2
 		void Reverse();
 
 		// Sorts elements in array by predicate
-		void Sort(const Function<bool(const _type&, const _type&)>& pred = Math::Fewer);
+		void Sort(const Function<bool(const _type&, const _type&)>& pred = Math::Fewer<_type>);
 
 		// Returns copy with sorts elements in array by predicate
-		Vector Sorted(const Function<bool(const _type&, const _type&)>& pred = Math::Fewer);
+		Vector Sorted(const Function<bool(const _type&, const _type&)>& pred = Math::Fewer<_type>);
 
 		// Return vector of elements which pass function
 		Vector FindAll(const Function<bool(const _type&)>& match) const;
@@ -297,9 +314,7 @@ namespace o2
 
 	template<typename _type>
 	Vector<_type>::~Vector()
-	{
-		std::vector<_type>::~vector<_type>();
-	}
+	{}
 
 	template<typename _type>
 	_type* Vector<_type>::Data()
@@ -109,8 +109,8 @@ namespace o2
 	TString<T>::TString(float value)
 	{
 		ConvertString(*this, TString<T>(std::to_string(value).c_str()));
-		erase(std::basic_string<T>::find_last_not_of('0') + 1, std::string::npos);
-		erase(std::basic_string<T>::find_last_not_of('.') + 1, std::string::npos);
+		this->erase(std::basic_string<T>::find_last_not_of('0') + 1, std::string::npos);
+		this->erase(std::basic_string<T>::find_last_not_of('.') + 1, std::string::npos);
 	}
 
 	template<typename T>
@@ -270,106 +270,71 @@ namespace o2
 	template<typename T>
 	TString<T>::operator Vec2F() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *px = c_str(), *py;
-			return Vec2F(wcstof(px, &py), wcstof(py, nullptr));
-		}
-		else
-		{
-			char *px = c_str(), *py;
-			return Vec2F(strtof(px, &py), strtof(py, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 2)
+			return Vec2F();
+
+		return Vec2F((float)values[0], (float)values[1]);
 	}
 
 	template<typename T>
 	TString<T>::operator Vec2I() const
 	{
-		if constexpr (std::is_same<T, wchar_t>)
-		{
-			wchar_t *px = c_str(), *py;
-			return Vec2F((int)wcstol(px, &py), (int)wcstol(py, nullptr));
-		}
-		else
-		{
-			char *px = c_str(), *py;
-			return Vec2F((int)strtol(px, &py), (int)strtol(py, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 2)
+			return Vec2I();
+
+		return Vec2I((int)values[0], (int)values[1]);
 	}
 
 	template<typename T>
 	TString<T>::operator RectF() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF(wcstof(pl, &pb), wcstof(pb, &pr), wcstof(pr, &pt), wcstof(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF(strtof(pl, &pb), strtof(pb, &pr), strtof(pr, &pt), strtof(pt, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 4)
+			return RectF();
+
+		return RectF((float)values[0], (float)values[1], (float)values[2], (float)values[3]);
 	}
 
 	template<typename T>
 	TString<T>::operator RectI() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)wcstol(pl, &pb), (int)wcstol(pb, &pr), (int)wcstol(pr, &pt), (int)wcstol(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)strtol(pl, &pb), (int)strtol(pb, &pr), (int)strtol(pr, &pt), (int)strtol(pt, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 4)
+			return RectI();
+
+		return RectI((int)values[0], (int)values[1], (int)values[2], (int)values[3]);
 	}
 
 	template<typename T>
 	TString<T>::operator BorderF() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF(wcstof(pl, &pb), wcstof(pb, &pr), wcstof(pr, &pt), wcstof(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF(strtof(pl, &pb), strtof(pb, &pr), strtof(pr, &pt), strtof(pt, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 4)
+			return BorderF();
+
+		return BorderF((float)values[0], (float)values[3], (float)values[2], (float)values[1]);
 	}
 
 	template<typename T>
 	TString<T>::operator BorderI() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)wcstol(pl, &pb), (int)wcstol(pb, &pr), (int)wcstol(pr, &pt), (int)wcstol(pt, nullptr));
-		}
-		else
-		{
-			char *pl = c_str(), *pb, *pr, *pt;
-			return RectF((int)strtol(pl, &pb), (int)strtol(pb, &pr), (int)strtol(pr, &pt), (int)strtol(pt, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 4)
+			return BorderI();
+
+		return BorderI((int)values[0], (int)values[3], (int)values[2], (int)values[1]);
 	}
 
 	template<typename T>
 	TString<T>::operator Color4() const
 	{
-		if constexpr (std::is_same<T, char>)
-		{
-			wchar_t *pr = c_str(), *pg, *pb, *pa;
-			return RectF((int)wcstol(pr, &pg), (int)wcstol(pg, &pb), (int)wcstol(pb, &pa), (int)wcstol(pa, nullptr));
-		}
-		else
-		{
-			char *pr = c_str(), *pg, *pb, *pa;
-			return RectF((int)strtol(pr, &pg), (int)strtol(pg, &pb), (int)strtol(pb, &pa), (int)strtol(pa, nullptr));
-		}
+		auto values = Split(";");
+		if (values.Count() != 4)
+			return Color4();
+
+		return Color4((int)values[0], (int)values[1], (int)values[2], (int)values[3]);
 	}
 
 	template<typename T>
@@ -1,9 +1,12 @@
 #pragma once
 
-#include "o2/Utils/Reflection/Type.h"
-
 namespace o2
 {
+	class Type;
+
+	template<typename _type>
+	const Type& GetTypeOf();
+
 	class IAbstractValueProxy
 	{
 	public:
@@ -23,7 +26,7 @@ namespace o2
 
 		void SetValuePtr(void* value) override { SetValue(*(_type*)value); }
 		void GetValuePtr(void* value) const override { *(_type*)value = GetValue(); }
-		const Type& GetType() const override { return TypeOf(_type); }
+		const Type& GetType() const override { return GetTypeOf<_type>(); }
 	};
 
 	class IPointerValueProxy